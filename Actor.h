@@ -151,6 +151,116 @@
 //  │ AActor Preparation ├─────►│ AActor::BeginPlay()│                                        
 //  └────────────────────┘      └────────────────────┘                                        
 
+/** 
+ * ULevel::ActorHotData에 액터와 같은 인덱스로 복사해두는 자주 읽히는 상태 비트들.
+ * @see ULevel::FLevelActorHotData
+ */
+enum class EActorHotFlags : uint8
+{
+	None						= 0,
+	Initialized					= 1 << 0,	// bActorInitialized
+	TickFunctionsRegistered		= 1 << 1,	// bTickFunctionsRegistered
+	HasBegunPlay				= 1 << 2,	// ActorHasBegunPlay == HasBegunPlay
+	AllComponentsRegistered		= 1 << 3,	// HasActorRegisteredAllComponents()
+};
+ENUM_CLASS_FLAGS(EActorHotFlags);
+
+/**
+ * 배치 틱 함수를 찾기 위한 키. 배치 틱 함수는 첫 액터의 틱 설정으로 등록되므로,
+ * 틱 스케줄에 영향을 주는 설정이 모두 같은 액터들만 하나의 배치를 공유한다.
+ */
+struct FActorTickBatchKey
+{
+    UClass* Class = nullptr;
+    ETickingGroup TickGroup = TG_PrePhysics;
+    ETickingGroup EndTickGroup = TG_PrePhysics;
+    float TickInterval = 0.f;
+    bool bTickEvenWhenPaused = false;
+
+    bool operator==(const FActorTickBatchKey& Other) const
+    {
+        return Class == Other.Class && TickGroup == Other.TickGroup && EndTickGroup == Other.EndTickGroup
+            && TickInterval == Other.TickInterval && bTickEvenWhenPaused == Other.bTickEvenWhenPaused;
+    }
+
+    friend uint32 GetTypeHash(const FActorTickBatchKey& Key)
+    {
+        uint32 Hash = HashCombine(GetTypeHash(Key.Class), GetTypeHash((uint8)Key.TickGroup));
+        Hash = HashCombine(Hash, GetTypeHash((uint8)Key.EndTickGroup));
+        Hash = HashCombine(Hash, GetTypeHash(Key.TickInterval));
+        return HashCombine(Hash, GetTypeHash(Key.bTickEvenWhenPaused));
+    }
+};
+
+/**
+ * 같은 클래스, 같은 틱 설정(FActorTickBatchKey)을 가진 액터들을 하나의 틱 함수로 묶어서 실행하는 배치 틱 함수.
+ * bBatchPrimaryActorTick이 켜진 액터들은 자신의 PrimaryActorTick 대신 이 틱 함수에 등록된다. (see ULevel::AddActorToTickBatch)
+ * 
+ * kwakkh
+ * - 액터마다 FActorTickFunction을 따로 등록하면, 같은 클래스 액터 1만 개를 틱할 때 1만 번의 가상 호출이 임의의 메모리 순서로 일어난다.
+ *   (i-cache: 틱 함수들 사이를 오가며 코드가 밀려남, d-cache: 액터들이 힙 여기저기에 흩어져 있음)
+ * - 배치 틱은 액터들을 주소 순으로 정렬해두고, 클래스당 한 번의 가상 호출(TickActorBatch) 안에서 순서대로 훑는다.
+ */
+USTRUCT()
+struct FActorBatchTickFunction : public FTickFunction
+{
+	GENERATED_USTRUCT_BODY()
+
+    /** 등록할 때 쓴 키. 액터의 틱 설정이 나중에 바뀌어도 이 키로 ULevel::ActorTickBatches에서 찾는다 */
+    FActorTickBatchKey Key;
+
+    /** 이 배치에 속한 액터들. 정렬은 다음 ExecuteTick에서 이뤄진다 */
+	TArray<AActor*> Actors;
+
+    void AddActor(AActor* Actor)
+    {
+        Actors.Add(Actor);
+        bNeedsSort = true;
+    }
+
+    void RemoveActor(AActor* Actor)
+    {
+        Actors.RemoveSingleSwap(Actor, EAllowShrinking::No);
+        bNeedsSort = true;
+    }
+
+	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+    {
+        if (bNeedsSort)
+        {
+            // 메모리 순서(주소 순)로 정렬 -> 순회할 때 하드웨어 프리페처가 따라올 수 있다
+            Algo::Sort(Actors);
+            bNeedsSort = false;
+        }
+
+        TickableActors.Reset();
+        for (AActor* Actor : Actors)
+        {
+            if (IsValid(Actor) && Actor->PrimaryActorTick.IsTickFunctionEnabled() && (TickType != LEVELTICK_ViewportsOnly || Actor->ShouldTickIfViewportsOnly()))
+            {
+                TickableActors.Add(Actor);
+            }
+        }
+
+        if (TickableActors.Num() > 0)
+        {
+            // 클래스당 한 번의 가상 호출
+            TickableActors[0]->TickActorBatch(TickableActors, DeltaTime, TickType);
+        }
+    }
+
+	ENGINE_API virtual FString DiagnosticMessage() override
+    {
+        return FString::Printf(TEXT("FActorBatchTickFunction[%d actors]"), Actors.Num());
+    }
+
+private:
+    /** 이번 프레임에 실제로 틱할 액터들 (매 프레임 재사용하여 할당을 피한다) */
+	TArray<AActor*> TickableActors;
+
+	bool bNeedsSort = false;
+};
+
 // see Actor's member variables (goto 13) 
 UCLASS(BlueprintType, Blueprintable, MigratingAsset, config=Engine, meta=(ShortTooltip="An Actor is an object that can be placed or spawned in the world."), MinimalAPI)
 class AActor : public UObject
@@ -181,9 +291,45 @@ public:
 	    bHasPreRegisteredAllComponents = true;
     }
 
+    /** 
+     * PreRegisterAllComponents 중 게임 스레드가 아닌 워커 스레드에서 실행해도 안전한 작업이 있으면 true를 반환하도록 오버라이드.
+     * true를 반환하는 액터는 ULevel의 병렬 사전 등록 단계에서 PreRegisterAllComponents_Concurrent가 워커 스레드에서 호출된다.
+     * kwakkh : 아직 이 함수를 오버라이드하는 엔진 액터 클래스는 없다. (see ULevel::ConcurrentPreRegisterComponents)
+     */
+	virtual bool CanPreRegisterComponentsConcurrently() const { return false; }
+
+    /** 
+     * 워커 스레드에서 호출되는 사전 등록 작업. 이 액터 자신의 데이터만 건드려야 하며, 다른 액터/월드/UObject 생성은 금지.
+     * 게임 스레드 전용 작업은 그대로 PreRegisterAllComponents에 남겨두면, 이후 직렬 단계에서 호출된다.
+     */
+	virtual void PreRegisterAllComponents_Concurrent() {}
+
     /** Return the ULevel that this Actor is part of. */
 	UFUNCTION(BlueprintCallable, Category=Level)
 	ENGINE_API ULevel* GetLevel() const
+    {
+        // kwakkh : GetWorld()가 매 틱마다 불리기 때문에, Outer 체인을 따라가며 IsA를 호출하는 비용을 캐시로 없앤다.
+        // - Outer 체인이 바뀌지 않았다면(GOuterChainSerialNumber가 그대로라면) 캐시된 레벨을 그대로 반환
+        // - 워커 스레드에서도 불리므로(병렬 사전 등록, 병렬 틱 등) 캐시는 게임 스레드만 갱신한다.
+        //   게임 스레드는 레벨을 먼저 쓰고 시리얼을 release로 쓰고, 읽는 쪽은 시리얼을 acquire로 읽은 뒤 레벨을 읽는다.
+        //   -> 새 시리얼이 보이면 그에 맞는 레벨도 반드시 보인다.
+        const uint64 CurrentSerialNumber = GOuterChainSerialNumber.load(std::memory_order_acquire);
+        if (CachedLevelSerialNumber.load(std::memory_order_acquire) == CurrentSerialNumber)
+        {
+            return CachedLevel.load(std::memory_order_relaxed);
+        }
+
+        ULevel* Level = GetTypedOuter<ULevel>();
+        if (IsInGameThread())
+        {
+            CachedLevel.store(Level, std::memory_order_relaxed);
+            CachedLevelSerialNumber.store(CurrentSerialNumber, std::memory_order_release);
+        }
+        return Level;
+    }
+
+    /** 캐시를 거치지 않고 Outer 체인을 직접 순회해 ULevel을 찾는다. (캐시 검증 및 비교용) */
+	ULevel* GetLevel_Uncached() const
     {
         return GetTypedOuter<ULevel>();
     }
@@ -228,12 +374,26 @@ public:
             {
                 PrimaryActorTick.Target = this;
                 PrimaryActorTick.SetTickFunctionEnable(PrimaryActorTick.bStartWithTickEnabled || PrimaryActorTick.IsTickFunctionEnabled());
-                PrimaryActorTick.RegisterTickFunction(GetLevel());
+
+                // kwakkh : 배치 틱 모드에서는 자신의 틱 함수를 등록하지 않고, 같은 클래스/틱 그룹의 배치 틱 함수에 합류한다.
+                // - 이때 PrimaryActorTick은 틱 활성화 여부만 들고 있는 용도로 쓰인다.
+                if (bBatchPrimaryActorTick && PrimaryActorTick.Prerequisites.Num() == 0)
+                {
+                    GetLevel()->AddActorToTickBatch(this);
+                }
+                else
+                {
+                    PrimaryActorTick.RegisterTickFunction(GetLevel());
+                }
             }
         }
         else
         {
-            if(PrimaryActorTick.IsTickFunctionRegistered())
+            if (TickBatch)
+            {
+                GetLevel()->RemoveActorFromTickBatch(this);
+            }
+            else if(PrimaryActorTick.IsTickFunctionRegistered())
             {
                 PrimaryActorTick.UnRegisterTickFunction();			
             }
@@ -242,9 +402,177 @@ public:
         FActorThreadContext::Get().TestRegisterTickFunctions = this; // we will verify the super call chain is intact. Don't copy and paste this to another actor class!
     }
 
+    /**
+     * 배치 틱 함수가 같은 클래스의 액터들을 한꺼번에 틱할 때 호출된다. Batch의 모든 액터는 this와 같은 클래스다.
+     * 기본 구현은 액터마다 TickActor를 호출한다. 
+     * 자식 클래스에서 final로 오버라이드하고 자기 타입으로 캐스팅해 비가상 함수를 호출하면, 루프 안의 가상 호출도 사라진다.
+     */
+	ENGINE_API virtual void TickActorBatch(TArrayView<AActor* const> Batch, float DeltaSeconds, ELevelTick TickType)
+    {
+        for (AActor* Actor : Batch)
+        {
+            Actor->TickActor(DeltaSeconds * Actor->CustomTimeDilation, TickType, Actor->PrimaryActorTick);
+        }
+    }
+
+    /**
+     * 배치 틱에서 빠져나와 자신의 PrimaryActorTick을 등록한다.
+     * kwakkh : 배치 틱 함수는 선행 조건을 표현할 수 없으므로, 등록 후에 선행 조건이 생기면 개별 틱으로 돌아간다
+     */
+    void LeaveTickBatch()
+    {
+        if (TickBatch)
+        {
+            GetLevel()->RemoveActorFromTickBatch(this);
+            PrimaryActorTick.RegisterTickFunction(GetLevel());
+        }
+    }
+
+    /** Make this actor tick after PrerequisiteActor. This only applies to this actor's tick function; dependencies for owned components must be set up separately if desired. */
+	ENGINE_API virtual void AddTickPrerequisiteActor(AActor* PrerequisiteActor)
+    {
+        if (PrimaryActorTick.bCanEverTick && PrerequisiteActor && PrerequisiteActor->PrimaryActorTick.bCanEverTick)
+        {
+            // kwakkh : 양쪽 모두 배치에 있으면 PrimaryActorTick이 등록되어 있지 않아 선행 조건이 무시된다
+            LeaveTickBatch();
+            PrerequisiteActor->LeaveTickBatch();
+            PrimaryActorTick.AddPrerequisite(PrerequisiteActor, PrerequisiteActor->PrimaryActorTick);
+        }
+    }
+
+    /** Make this actor tick after PrerequisiteComponent. This only applies to this actor's tick function; dependencies for owned components must be set up separately if desired. */
+	ENGINE_API virtual void AddTickPrerequisiteComponent(UActorComponent* PrerequisiteComponent)
+    {
+        if (PrimaryActorTick.bCanEverTick && PrerequisiteComponent && PrerequisiteComponent->PrimaryComponentTick.bCanEverTick)
+        {
+            LeaveTickBatch();
+            PrimaryActorTick.AddPrerequisite(PrerequisiteComponent, PrerequisiteComponent->PrimaryComponentTick);
+        }
+    }
+
+    /** Sets the tick interval of this actor's primary tick function. Will not enable a disabled tick function. Takes effect on next tick. */
+	UFUNCTION(BlueprintCallable, Category="Actor|Tick")
+	ENGINE_API void SetActorTickInterval(float TickInterval)
+    {
+        PrimaryActorTick.UpdateTickIntervalAndCoolDown(TickInterval);
+
+        // kwakkh : 틱 간격은 배치 키의 일부이므로, 같은 간격의 배치로 옮긴다
+        if (TickBatch)
+        {
+            GetLevel()->RemoveActorFromTickBatch(this);
+            GetLevel()->AddActorToTickBatch(this);
+        }
+    }
+
     /** Returns whether an actor has been initialized for gameplay */
 	bool IsActorInitialized() const { return bActorInitialized; }
 
+    /** ULevel의 SoA 사이드 테이블에 복사할 상태 비트들을 모아서 반환 */
+	EActorHotFlags GetHotFlags() const
+    {
+        EActorHotFlags Flags = EActorHotFlags::None;
+        if (bActorInitialized)                                      { Flags |= EActorHotFlags::Initialized; }
+        if (bTickFunctionsRegistered)                               { Flags |= EActorHotFlags::TickFunctionsRegistered; }
+        if (ActorHasBegunPlay == EActorBeginPlayState::HasBegunPlay) { Flags |= EActorHotFlags::HasBegunPlay; }
+        if (HasActorRegisteredAllComponents())                      { Flags |= EActorHotFlags::AllComponentsRegistered; }
+        return Flags;
+    }
+
+    /** GetHotFlags()에 들어가는 상태가 바뀐 직후 호출해서 레벨의 사이드 테이블을 갱신한다 */
+	void UpdateLevelHotData()
+    {
+        if (ULevel* Level = GetLevel())
+        {
+            Level->UpdateActorHotData(this);
+        }
+    }
+
+    /** 
+     * Sets root component to be the specified component.  NewRootComponent's owner should be this actor.
+     * @return true if root component was successfully changed, false otherwise.
+     */
+	UFUNCTION(BlueprintCallable, Category = "Utilities|Transformation")
+	ENGINE_API bool SetRootComponent(USceneComponent* NewRootComponent)
+    {
+        if (NewRootComponent == nullptr || NewRootComponent->GetOwner() == this)
+        {
+            if (RootComponent != NewRootComponent)
+            {
+                //...
+                RootComponent = NewRootComponent;
+                UpdateLevelHotData();
+                //...
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /** Called after all the components in the Components array are unregistered */
+	ENGINE_API virtual void PostUnregisterAllComponents()
+    {
+        //...
+        bHasRegisteredAllComponents = false;
+        UpdateLevelHotData();
+    }
+
+    /** Allow actors to initialize themselves on the C++ side after all of their components have been initialized, only called during gameplay */
+	ENGINE_API virtual void PostInitializeComponents()
+    {
+        if( IsValidChecked(this) )
+        {
+            bActorInitialized = true;
+            UpdateLevelHotData();
+
+            //...
+        }
+    }
+
+    /** Initiate a begin play call on this Actor, will handle calling in the correct order. */
+	ENGINE_API void DispatchBeginPlay(bool bFromLevelStreaming = false)
+    {
+        //...
+
+        ActorHasBegunPlay = EActorBeginPlayState::BeginningPlay;
+        BeginPlay();
+
+        //...
+
+        ActorHasBegunPlay = EActorBeginPlayState::HasBegunPlay;
+        UpdateLevelHotData();
+    }
+
+    /** Overridable function called whenever this actor is being removed from a level */
+	ENGINE_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason)
+    {
+        if (ActorHasBegunPlay == EActorBeginPlayState::HasBegunPlay)
+        {
+            //...
+
+            ActorHasBegunPlay = EActorBeginPlayState::HasNotBegunPlay;
+            UpdateLevelHotData();
+        }
+        //...
+    }
+
+    /** When called, will call the virtual call chain to register all of the tick functions for both the actor and optionally all components. */
+	ENGINE_API void RegisterAllActorTickFunctions(bool bRegister, bool bDoComponents)
+    {
+        if(!IsTemplate())
+        {
+            // Prevent repeated redundant attempts
+            if (bTickFunctionsRegistered != bRegister)
+            {
+                //...
+                RegisterActorTickFunctions(bRegister);
+                bTickFunctionsRegistered = bRegister;
+                UpdateLevelHotData();
+                //...
+            }
+            //...
+        }
+    }
+
     // 13 - Foundation - CreateWorld - AActor's member variables
 
     /**
@@ -294,6 +622,24 @@ public:
 	 */
 	EActorBeginPlayState ActorHasBegunPlay : 2;
 
+    /** 
+     * true이면 PrimaryActorTick을 따로 등록하지 않고, 같은 클래스/틱 그룹 액터들과 함께 FActorBatchTickFunction으로 틱한다.
+     * 틱 선행 조건(Prerequisites)이 있는 액터는 배치에 들어가지 않고 기존 방식으로 등록된다.
+     * 등록 후에 AddTickPrerequisiteActor / AddTickPrerequisiteComponent로 선행 조건이 생기면 배치를 떠난다. (PrimaryActorTick.AddPrerequisite를 직접 부르면 반영되지 않는다)
+     */
+	UPROPERTY(EditDefaultsOnly, Category=Tick)
+	uint8 bBatchPrimaryActorTick : 1;
+
+
+    /** 
+     * 레벨 사이드 테이블(ULevel::ActorHotData)에서 이 액터의 인덱스. RebuildActorHotData에서 기록된다.
+     * Actors 배열이 바뀌면 틀릴 수 있으므로 사용할 때마다 검증한다. (see ULevel::UpdateActorHotData)
+     */
+	int32 LevelHotDataIndex = INDEX_NONE;
+
+    /** 합류한 배치 틱 함수. nullptr이면 PrimaryActorTick이 직접 등록되어 있다 (see ULevel::AddActorToTickBatch) */
+	FActorBatchTickFunction* TickBatch = nullptr;
+
 
     /** 이것은 월드 내에서 이 액터의 트랜스폼(위치, 회전, 스케일)을 정의하는 컴포넌트이며, 
      * 다른 모든 컴포넌트들은 어떤 식으로든 이 컴포넌트에 부착(Attached)되어야 한다. 
@@ -371,4 +717,14 @@ public:
      */
 	UPROPERTY()
 	TWeakObjectPtr<UChildActorComponent> ParentComponent;
+
+private:
+    /** 
+     * GetLevel()의 결과를 캐시한 값. CachedLevelSerialNumber가 GOuterChainSerialNumber와 다르면 무효. (게임 스레드만 갱신)
+     * kwakkh
+     * - 레벨은 액터의 Outer이므로 액터보다 먼저 파괴될 수 없다. 따라서 UPROPERTY로 잡아둘 필요가 없다.
+     * - 월드는 Level->OwningWorld로 바로 얻을 수 있으므로, 레벨만 캐시하면 GetWorld()도 O(1)이 된다.
+     */
+	mutable std::atomic<ULevel*> CachedLevel = nullptr;
+	mutable std::atomic<uint64> CachedLevelSerialNumber = 0;
 };
\ No newline at end of file
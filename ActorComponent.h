@@ -0,0 +1,53 @@
+/**
+ * ActorComponent는 서로 다른 종류의 액터에 추가할 수 있는, 재사용 가능한 동작을 정의하는 컴포넌트들의 기본 클래스
+ * Transform을 가지는 ActorComponent는 SceneComponent라고 하며, 렌더링이 가능한 것은 PrimitiveComponent라고 한다.
+ * 
+ * @see [ActorComponent](https://docs.unrealengine.com/latest/INT/Programming/UnrealArchitecture/Actors/Components/index.html#actorcomponents)
+ * @see USceneComponent
+ * @see UPrimitiveComponent
+ * 
+ * kwakkh : ActorComponent.h 에 존재
+ * - 여기서는 컴포넌트가 월드에 등록/해제되는 시점만 발췌
+ */
+UCLASS(DefaultToInstanced, BlueprintType, abstract, meta=(ShortTooltip="An ActorComponent is a reusable component that can be added to any actor."), config=Engine, MinimalAPI)
+class UActorComponent : public UObject, public IInterface_AssetUserData
+{
+	GENERATED_BODY()
+
+    /** 이 컴포넌트가 속한 ULevel을 반환 (소유 액터의 레벨) */
+	ENGINE_API ULevel* GetComponentLevel() const;
+
+    /** 등록 이벤트들(렌더/물리 State 생성 등)을 실행 */
+	ENGINE_API void ExecuteRegisterEvents(FRegisterComponentContext* Context = nullptr)
+    {
+        //...
+
+        // kwakkh : 레벨 단위 컴포넌트 레지스트리에 추가 (see FLevelComponentRegistry)
+        if (ULevel* Level = GetComponentLevel())
+        {
+            Level->ComponentRegistry.Add(this);
+        }
+    }
+
+    /** 등록 해제 이벤트들(렌더/물리 State 파괴 등)을 실행 */
+	ENGINE_API void ExecuteUnregisterEvents()
+    {
+        //...
+
+        // kwakkh : 지금의 GetComponentLevel()이 아니라 등록할 때의 레지스트리에서 제거한다.
+        // - 등록 이후 소유 액터가 다른 레벨로 옮겨졌을 수 있기 때문
+        if (OwningComponentRegistry)
+        {
+            OwningComponentRegistry->Remove(this);
+        }
+    }
+
+private:
+    /** 소유 레벨의 FLevelComponentRegistry 버킷 안에서의 인덱스. 등록되어 있지 않으면 INDEX_NONE */
+	int32 ComponentRegistryIndex = INDEX_NONE;
+
+    /** 이 컴포넌트가 등록된 레지스트리 (등록 당시 레벨의 ComponentRegistry). 등록되어 있지 않으면 nullptr */
+	FLevelComponentRegistry* OwningComponentRegistry = nullptr;
+
+	friend struct FLevelComponentRegistry;
+};
@@ -0,0 +1,250 @@
+/**
+ * kwakkh
+ * - GuardedMain의 엔진 시작(boot) 단계를 계층적으로 측정하는 부트 프로파일러
+ * - 기존에는 BootTimingPoint("DefaultMain")와 EngineInitializationTime 정도만 남아서,
+ *   EnginePreInit / EditorInit / EngineInit 내부에서 어디에 시간이 쓰이는지 알 수 없었다.
+ * - 스코프마다 시작/길이, 스레드 ID, 중첩 깊이, 할당 횟수를 기록하고 Chrome Trace(Perfetto에서도 열림) JSON으로 저장한다.
+ *   - 명령줄 "-BootProfile" 또는 "-BootProfile=<파일 경로>"로 켠다.
+ *   - CI에서 프로파일러를 붙이지 않고도 콜드 스타트 회귀를 비교할 수 있다.
+ */
+
+/** 0이 아니면 BOOT_PROFILER_SCOPE가 기록된다. GuardedMain에서 명령줄을 보고 설정 */
+extern LAUNCH_API int32 GBootProfilerEnabled;
+
+/**
+ * 할당 횟수를 세기 위해 GMalloc을 감싸는 프록시.
+ * kwakkh : 모든 호출을 내부 할당자로 그대로 넘기고, 스레드별 할당 횟수만 센다.
+ * - 설치 전에 할당된 메모리도 내부 할당자가 해제하므로, 부트 도중에 설치해도 안전하다. (해제할 때도 마찬가지 - see FBootProfiler::Stop)
+ */
+class FBootProfilerMallocProxy : public FMalloc
+{
+public:
+    explicit FBootProfilerMallocProxy(FMalloc* InInnerMalloc)
+        : InnerMalloc(InInnerMalloc)
+    {
+    }
+
+    virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return InnerMalloc->Malloc(Size, Alignment);
+    }
+
+    virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return InnerMalloc->TryMalloc(Size, Alignment);
+    }
+
+    virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return InnerMalloc->Realloc(Original, Size, Alignment);
+    }
+
+    virtual void* TryRealloc(void* Original, SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return InnerMalloc->TryRealloc(Original, Size, Alignment);
+    }
+
+    virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+    virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+    virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+    virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+    virtual void MarkTLSCachesAsUsedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUsedOnCurrentThread(); }
+    virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUnusedOnCurrentThread(); }
+    virtual void OnMallocInitialized() override { InnerMalloc->OnMallocInitialized(); }
+    virtual void OnPreFork() override { InnerMalloc->OnPreFork(); }
+    virtual void OnPostFork() override { InnerMalloc->OnPostFork(); }
+    virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+    virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+    virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+    virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+    virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+    virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+    virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+    /** 현재 스레드에서 지금까지 일어난 할당 횟수 (스코프 시작/끝의 차이로 스코프의 할당 횟수를 구한다) */
+    static uint64 GetThreadAllocationCount() { return ThreadAllocationCount; }
+
+    FMalloc* GetInnerMalloc() const { return InnerMalloc; }
+
+private:
+    static void CountAllocation()
+    {
+        ++ThreadAllocationCount;
+    }
+
+    FMalloc* InnerMalloc;
+
+    static inline thread_local uint64 ThreadAllocationCount = 0;
+};
+
+/**
+ * 부트 프로파일러 본체.
+ *
+ * kwakkh
+ * - 스코프가 끝날 때 이벤트 하나(Chrome Trace의 "X" complete event)를 남긴다.
+ *   - 중첩 관계는 같은 스레드 안에서 시작/길이로 표현되므로 따로 부모 인덱스를 저장하지 않는다. (Depth는 요약 로그용)
+ * - 여러 스레드에서 기록할 수 있도록 이벤트 추가만 락으로 보호한다. 부트 중 스코프 수는 많지 않으므로 충분하다.
+ * - 시간은 GStartTime 기준 마이크로초
+ */
+class FBootProfiler
+{
+public:
+    struct FEvent
+    {
+        const TCHAR* Name;
+        double StartMicroseconds;
+
+        /** 음수면 순간 이벤트 (BootTimingPoint 같은 마커) */
+        double DurationMicroseconds;
+
+        uint32 ThreadId;
+        int32 Depth;
+        uint64 NumAllocations;
+    };
+
+    static FBootProfiler& Get()
+    {
+        static FBootProfiler Instance;
+        return Instance;
+    }
+
+    /** 프로파일링 시작. 할당 횟수를 세기 위해 GMalloc을 프록시로 감싼다 */
+    void Start()
+    {
+        if (GBootProfilerEnabled)
+        {
+            return;
+        }
+        GBootProfilerEnabled = 1;
+        MallocProxy = new FBootProfilerMallocProxy(GMalloc);
+        GMalloc = MallocProxy;
+    }
+
+    /**
+     * 프로파일링 종료. 새 스코프 기록을 멈추고 GMalloc을 원래 할당자로 되돌린다. (트레이스 저장 후 GuardedMain에서 호출)
+     * kwakkh : 다른 스레드가 이미 읽어간 GMalloc으로 프록시를 호출하고 있을 수 있으므로 프록시 객체는 지우지 않는다. (프로세스당 한 번, 포인터 하나 크기)
+     */
+    void Stop()
+    {
+        if (!GBootProfilerEnabled)
+        {
+            return;
+        }
+        GBootProfilerEnabled = 0;
+        if (GMalloc == MallocProxy)
+        {
+            GMalloc = MallocProxy->GetInnerMalloc();
+        }
+    }
+
+    void AddEvent(const FEvent& Event)
+    {
+        FScopeLock Lock(&EventsLock);
+        Events.Add(Event);
+    }
+
+    /** 순간 이벤트 (길이 없는 마커) */
+    void Mark(const TCHAR* Name)
+    {
+        if (GBootProfilerEnabled)
+        {
+            AddEvent({ Name, GetNowMicroseconds(), -1.0, FPlatformTLS::GetCurrentThreadId(), 0, 0 });
+        }
+    }
+
+    static double GetNowMicroseconds() { return (FPlatformTime::Seconds() - GStartTime) * 1000000.0; }
+
+    /** Chrome Trace 포맷(JSON)으로 저장. chrome://tracing 또는 ui.perfetto.dev에서 열 수 있다 */
+    bool WriteChromeTrace(const FString& Filename)
+    {
+        FScopeLock Lock(&EventsLock);
+
+        FString Json;
+        Json.Reserve(Events.Num() * 160);
+        Json += TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        for (int32 Index = 0; Index < Events.Num(); ++Index)
+        {
+            const FEvent& Event = Events[Index];
+            FString EscapedName = FString(Event.Name).ReplaceCharWithEscapedChar();
+            if (Event.DurationMicroseconds < 0.0)
+            {
+                Json += FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%u,\"tid\":%u}"),
+                    *EscapedName, Event.StartMicroseconds, FPlatformProcess::GetCurrentProcessId(), Event.ThreadId);
+            }
+            else
+            {
+                Json += FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%u,\"tid\":%u,\"args\":{\"depth\":%d,\"allocs\":%llu}}"),
+                    *EscapedName, Event.StartMicroseconds, Event.DurationMicroseconds, FPlatformProcess::GetCurrentProcessId(), Event.ThreadId, Event.Depth, Event.NumAllocations);
+            }
+            Json += (Index + 1 < Events.Num()) ? TEXT(",\n") : TEXT("\n");
+        }
+        Json += TEXT("]}\n");
+
+        return FFileHelper::SaveStringToFile(Json, *Filename);
+    }
+
+    /** 최상위 깊이(MaxDepth 이하) 스코프들의 시간 / 할당 요약을 로그로 남긴다 */
+    void LogSummary(int32 MaxDepth = 1)
+    {
+        FScopeLock Lock(&EventsLock);
+        for (const FEvent& Event : Events)
+        {
+            if (Event.DurationMicroseconds >= 0.0 && Event.Depth <= MaxDepth)
+            {
+                UE_LOG(LogInit, Display, TEXT("BootProfile: %*s%s %.2f ms, %llu allocs (thread %u)"),
+                    Event.Depth * 2, TEXT(""), Event.Name, Event.DurationMicroseconds / 1000.0, Event.NumAllocations, Event.ThreadId);
+            }
+        }
+    }
+
+private:
+    FCriticalSection EventsLock;
+    TArray<FEvent> Events;
+
+    FBootProfilerMallocProxy* MallocProxy = nullptr;
+};
+
+/** BOOT_PROFILER_SCOPE가 만드는 스코프 객체. 스레드별 깊이를 추적한다 */
+struct FBootProfilerScope
+{
+    explicit FBootProfilerScope(const TCHAR* InName)
+        : Name(InName)
+        , bEnabled(GBootProfilerEnabled != 0)
+    {
+        if (bEnabled)
+        {
+            Depth = ThreadDepth++;
+            StartAllocations = FBootProfilerMallocProxy::GetThreadAllocationCount();
+            StartMicroseconds = FBootProfiler::GetNowMicroseconds();
+        }
+    }
+
+    ~FBootProfilerScope()
+    {
+        if (bEnabled)
+        {
+            const double EndMicroseconds = FBootProfiler::GetNowMicroseconds();
+            --ThreadDepth;
+            FBootProfiler::Get().AddEvent({ Name, StartMicroseconds, EndMicroseconds - StartMicroseconds, FPlatformTLS::GetCurrentThreadId(), Depth,
+                FBootProfilerMallocProxy::GetThreadAllocationCount() - StartAllocations });
+        }
+    }
+
+private:
+    const TCHAR* Name;
+    bool bEnabled;
+    int32 Depth = 0;
+    uint64 StartAllocations = 0;
+    double StartMicroseconds = 0.0;
+
+    static inline thread_local int32 ThreadDepth = 0;
+};
+
+/** 부트 단계 스코프 측정. Name은 문자열 리터럴이어야 한다 (포인터만 저장) */
+#define BOOT_PROFILER_SCOPE(Name) FBootProfilerScope PREPROCESSOR_JOIN(BootProfilerScope, __LINE__)(TEXT(Name))
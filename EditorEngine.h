@@ -1,4 +1,5 @@
 #include "World.h"
+#include "FramePacer.h"
 
 /** Specifies the goal/source of a UWorld object */
 // 14 - Foundation - Entry - EWorldType
@@ -33,7 +34,10 @@ namespace EWorldType
 		GameRPC,
 
 		/** An editor world that was loaded but not currently being edited in the level editor */
-		Inactive
+		Inactive,
+
+		// kwakkh : 월드 타입별 배열의 크기로 사용
+		Num
 	};
 }
 
@@ -97,13 +101,35 @@ struct FWorldContext
         UWorld* OldWorld = ThisCurrentWorld;
         ThisCurrentWorld = World;
 
+        // kwakkh : 엔진의 UWorld* -> FWorldContext 조회 맵도 함께 갱신
+        if (GEngine)
+        {
+            GEngine->OnWorldContextWorldChanged(*this, OldWorld, ThisCurrentWorld);
+        }
+
         if (OwningGameInstance)
         {
             OwningGameInstance->OnWorldChanged(OldWorld, ThisCurrentWorld);
         }
     }
 
+    /** 
+     * 컨텍스트의 월드 타입을 바꾼다 (ex. PIE 준비 중 Game -> PIE)
+     * kwakkh : 엔진의 타입별 색인(WorldContextsByType)도 함께 옮기므로, 생성 이후에는 WorldType에 직접 대입하지 말고 이 함수를 쓴다
+     */
+	ENGINE_API void SetWorldType(EWorldType::Type InWorldType)
+    {
+        const EWorldType::Type OldWorldType = WorldType;
+        WorldType = InWorldType;
+
+        if (GEngine && OldWorldType != InWorldType)
+        {
+            GEngine->OnWorldContextTypeChanged(*this, OldWorldType, InWorldType);
+        }
+    }
+
     // see EWorldType
+    // kwakkh : 생성 이후에 바꿀 때는 SetWorldType을 사용
     TEnumAsByte<EWorldType::Type>	WorldType;
 
     // kwakkh : UWorld의 이름과 다른 Context에 별도의 이름을 할당
@@ -121,6 +147,108 @@ private:
 	TObjectPtr<UWorld>	ThisCurrentWorld;
 }
 
+/**
+ * UEngine::WorldList의 저장소. FWorldContext들을 슬랩(slab, 고정 크기 덩어리) 단위로 할당한다.
+ * 
+ * kwakkh
+ * - TIndirectArray는 컨텍스트마다 new/delete를 한다. PIE나 프리뷰 세션을 반복하면 할당/해제가 쌓여 힙이 조각난다.
+ * - 슬랩은 ContextsPerSlab개씩 한 번에 할당하고, 파괴된 자리는 프리 리스트(free list)에 넣어 다음 생성에서 재사용한다.
+ * - 슬랩 자체는 해제하지 않으므로 컨텍스트의 주소는 살아있는 동안 절대 바뀌지 않는다. (TIndirectArray와 같은 보장)
+ * - WorldList[i], WorldList.Num(), for (FWorldContext& Context : WorldList)처럼 TIndirectArray와 같은 방식으로 쓸 수 있다.
+ * 
+ *  Diagram:
+ *    Slabs:     [Slab0: ctx0 ctx1 (free) ctx3 ...] [Slab1: ...]
+ *    Contexts:  [&ctx0, &ctx3, &ctx1]   (WorldList의 순서)
+ *    FreeSlots: [&Slab0[2]]
+ */
+class FWorldContextList
+{
+public:
+    ~FWorldContextList()
+    {
+        for (FWorldContext* Context : Contexts)
+        {
+            Context->~FWorldContext();
+        }
+    }
+
+    /** 새 컨텍스트를 생성해 목록 끝에 추가한다 */
+    FWorldContext& Emplace()
+    {
+        if (FreeSlots.Num() == 0)
+        {
+            FSlab* Slab = Slabs.Add_GetRef(MakeUnique<FSlab>()).Get();
+            ++NumSlabAllocations;
+            for (int32 SlotIndex = ContextsPerSlab - 1; SlotIndex >= 0; --SlotIndex)
+            {
+                FreeSlots.Add(Slab->Slots[SlotIndex].GetTypedPtr());
+            }
+        }
+
+        FWorldContext* Context = new (FreeSlots.Pop(EAllowShrinking::No)) FWorldContext();
+        Contexts.Add(Context);
+        ++NumCreated;
+        return *Context;
+    }
+
+    /** 컨텍스트를 목록에서 빼고 파괴한다. 자리는 다음 Emplace에서 재사용된다 */
+    void Remove(FWorldContext* Context)
+    {
+        const int32 Index = Contexts.Find(Context);
+        check(Index != INDEX_NONE);
+        Contexts.RemoveAt(Index);
+
+        Context->~FWorldContext();
+        FreeSlots.Add(Context);
+        ++NumDestroyed;
+    }
+
+    int32 Num() const { return Contexts.Num(); }
+    FWorldContext& operator[](int32 Index) { return *Contexts[Index]; }
+    const FWorldContext& operator[](int32 Index) const { return *Contexts[Index]; }
+
+    /** 범위 기반 for 루프용 반복자. TIndirectArray처럼 포인터가 아닌 FWorldContext&를 돌려준다 */
+    template <typename ElementType, typename PointerIteratorType>
+    class TIterator
+    {
+    public:
+        explicit TIterator(PointerIteratorType InIt) : It(InIt) {}
+
+        ElementType& operator*() const { return **It; }
+        ElementType* operator->() const { return *It; }
+        TIterator& operator++() { ++It; return *this; }
+        bool operator!=(const TIterator& Other) const { return It != Other.It; }
+
+    private:
+        PointerIteratorType It;
+    };
+
+    using FIterator = TIterator<FWorldContext, TArray<FWorldContext*>::RangedForIteratorType>;
+    using FConstIterator = TIterator<const FWorldContext, TArray<FWorldContext*>::RangedForConstIteratorType>;
+
+    FIterator begin() { return FIterator(Contexts.begin()); }
+    FIterator end() { return FIterator(Contexts.end()); }
+    FConstIterator begin() const { return FConstIterator(Contexts.begin()); }
+    FConstIterator end() const { return FConstIterator(Contexts.end()); }
+
+    /** 누수/할당 횟수 확인용 통계: 살아있는 컨텍스트 수 == NumCreated - NumDestroyed, 슬랩 할당 횟수는 동시 최대 컨텍스트 수에 비례 */
+    int32 NumCreated = 0;
+    int32 NumDestroyed = 0;
+    int32 NumSlabAllocations = 0;
+
+private:
+    static constexpr int32 ContextsPerSlab = 8;
+
+    struct FSlab
+    {
+        TTypeCompatibleBytes<FWorldContext> Slots[ContextsPerSlab];
+    };
+
+    TArray<TUniquePtr<FSlab>> Slabs;
+    TArray<FWorldContext*> FreeSlots;
+    TArray<FWorldContext*> Contexts;
+};
+
 // 12 - Foundation - Entry - UEngine
 /**
  * 모든 엔진 클래스들의 추상 기본 클래스이며, 에디터 및 게임 시스템에 필수적인 핵심 시스템들의 관리를 담당합니다.
@@ -133,17 +261,113 @@ class UEngine : public UObject, public FExec
 
     //...
 
+    /** Executes internal exit functionality. */
+	ENGINE_API virtual void PreExit()
+    {
+        //...
+        // kwakkh : 풀에 보관 중인 월드는 AddToRoot 상태라 GC로 정리되지 않으므로, 월드 컨텍스트 정리 전에 직접 파괴한다
+        FWorldPool::Get().Empty();
+        //...
+    }
+
     // kwakkh : WorldType에 맞는 WorldContext 생성하고 반환하는 함수 (이 함수에서 World를 세팅하지 않음!)
     FWorldContext& CreateNewWorldContext(EWorldType::Type WorldType)
     {
-        FWorldContext* NewWorldContext = new FWorldContext;
-        WorldList.Add(NewWorldContext);
+        FWorldContext* NewWorldContext = &WorldList.Emplace();
         NewWorldContext->WorldType = WorldType;
-        NewWorldContext->ContextHandle = FName(*FString::Printf(TEXT("Context_%d"), NextWorldContextHandle++));
+        NewWorldContext->ContextHandle = AcquireWorldContextHandle();
+
+        WorldContextsByHandle.Add(NewWorldContext->ContextHandle, NewWorldContext);
+        WorldContextsByType[WorldType].Add(NewWorldContext);
 
         return *NewWorldContext;
     }
 
+    /** 월드에 해당하는 WorldContext를 WorldList에서 제거하고 파괴한다 */
+    void DestroyWorldContext(UWorld * InWorld)
+    {
+        FWorldContext* Context = GetWorldContextFromWorld(InWorld);
+        if (!Context)
+        {
+            return;
+        }
+
+        WorldContextsByWorld.Remove(InWorld);
+        WorldContextsByHandle.Remove(Context->ContextHandle);
+        if (!ensureMsgf(WorldContextsByType[Context->WorldType].RemoveSingle(Context) == 1, TEXT("WorldContext %s: WorldType was changed without FWorldContext::SetWorldType"), *Context->ContextHandle.ToString()))
+        {
+            // 색인이 어긋났더라도 해제된 컨텍스트를 가리키는 항목이 남지 않도록 모든 타입에서 지운다
+            for (TArray<FWorldContext*>& Contexts : WorldContextsByType)
+            {
+                Contexts.RemoveSingle(Context);
+            }
+        }
+
+        WorldList.Remove(Context);
+    }
+
+    /** 
+     * 새 컨텍스트 핸들을 발급한다.
+     * kwakkh
+     * - 예전에는 FString::Printf("Context_%d")로 문자열을 만든 뒤 FName으로 변환했다. (컨텍스트마다 문자열 포맷 + 할당)
+     * - FName은 "기본 이름 + 번호" 형태로 저장되므로, 미리 만들어둔 "Context" 이름에 번호만 붙이면 문자열 작업이 필요 없다.
+     *   - 번호는 이름 테이블에 새 항목을 만들지 않으므로, 번호가 계속 커져도 이름 테이블은 자라지 않는다.
+     * - 번호는 재사용하지 않는다. 파괴된 컨텍스트의 핸들로 GetWorldContextFromHandle을 호출하면 새 컨텍스트가 아니라 nullptr이 나온다.
+     */
+    FName AcquireWorldContextHandle()
+    {
+        static const FName NAME_Context(TEXT("Context"));
+        return FName(NAME_Context, NAME_EXTERNAL_TO_INTERNAL(NextWorldContextHandle++));
+    }
+
+    /** 
+     * UWorld*로 WorldContext를 찾는다. 없으면 nullptr
+     * kwakkh : 예전에는 WorldList를 선형 탐색했다. 멀티 클라이언트 PIE + 프리뷰 월드가 많으면 목록이 길어지므로 해시 맵으로 찾는다.
+     */
+    FWorldContext* GetWorldContextFromWorld(const UWorld* InWorld)
+    {
+        FWorldContext** Context = WorldContextsByWorld.Find(InWorld);
+        return Context ? *Context : nullptr;
+    }
+
+    /** ContextHandle로 WorldContext를 찾는다. 없으면 nullptr */
+    FWorldContext* GetWorldContextFromHandle(const FName WorldContextHandle)
+    {
+        FWorldContext** Context = WorldContextsByHandle.Find(WorldContextHandle);
+        return Context ? *Context : nullptr;
+    }
+
+    /** 해당 타입의 WorldContext들 (이 타입이 된 순서: 생성 또는 SetWorldType) */
+    TArrayView<FWorldContext* const> GetWorldContextsOfType(EWorldType::Type WorldType) const
+    {
+        return WorldContextsByType[WorldType];
+    }
+
+    /** FWorldContext::SetCurrentWorld에서 호출되어 UWorld* -> FWorldContext 맵을 갱신한다 */
+    void OnWorldContextWorldChanged(FWorldContext& Context, UWorld* OldWorld, UWorld* NewWorld)
+    {
+        // kwakkh : 같은 월드를 다른 컨텍스트가 이미 가리키고 있을 수 있으므로(컨텍스트 간 월드 이동), 이 컨텍스트의 항목일 때만 지운다
+        if (OldWorld)
+        {
+            FWorldContext** Existing = WorldContextsByWorld.Find(OldWorld);
+            if (Existing && *Existing == &Context)
+            {
+                WorldContextsByWorld.Remove(OldWorld);
+            }
+        }
+        if (NewWorld)
+        {
+            WorldContextsByWorld.Add(NewWorld, &Context);
+        }
+    }
+
+    /** FWorldContext::SetWorldType에서 호출되어 타입별 색인에서 컨텍스트를 옮긴다 */
+    void OnWorldContextTypeChanged(FWorldContext& Context, EWorldType::Type OldWorldType, EWorldType::Type NewWorldType)
+    {
+        WorldContextsByType[OldWorldType].RemoveSingle(&Context);
+        WorldContextsByType[NewWorldType].Add(&Context);
+    }
+
     /** Initialize the game engine. */
     // 17 - Foundation - Entry - UEngine::Init
     /**
@@ -165,6 +389,50 @@ class UEngine : public UObject, public FExec
             InitialWorldContext.SetCurrentWorld( UWorld::CreateWorld( EWorldType::Editor, true ) );
             GWorld = InitialWorldContext.World();
         }
+
+        // kwakkh : 프레임 페이서의 유휴 시간에 GC의 점진적 정리(purge)를 진행한다. (GAdaptiveFramePacing일 때만 실행됨)
+        FramePacer.AddIdleWork(TEXT("IncrementalPurgeGarbage"), [](double Deadline)
+        {
+            if (!IsIncrementalPurgePending())
+            {
+                return false;
+            }
+            IncrementalPurgeGarbage(true, (float)FMath::Max(Deadline - FPlatformTime::Seconds(), 0.0));
+            return IsIncrementalPurgePending();
+        });
+    }
+
+    /** 
+     * FApp::CurrentTime, FApp::DeltaTime을 갱신하고, 필요하면 최대 틱 레이트를 지키기 위해 기다린다.
+     * kwakkh : FEngineLoop::Tick에서 매 프레임 호출 (see FEngineLoop::Tick)
+     */
+    virtual void UpdateTimeAndHandleMaxTickRate()
+    {
+        //...
+
+        // kwakkh : 고정 틱(FApp::UseFixedTimeStep)에서는 위의 생략된 부분에서 CurrentTime이 FixedDeltaTime만큼만 진행된다.
+        // - bSkipMaxTickRateWait이면 벽시계에 맞추기 위한 대기를 하지 않는다. (EngineTickBatch)
+        const float MaxTickRate = GetMaxTickRate(FApp::GetDeltaTime(), false);
+        if (MaxTickRate > 0.f && !bSkipMaxTickRateWait)
+        {
+            const double WaitEndTime = FApp::GetLastTime() + 1.0 / MaxTickRate;
+
+            // kwakkh : 적응형 페이싱 모드에서는 sleep 한 번 대신 유휴 작업 -> sleep -> spin 순서로 기다린다. (see FFramePacer)
+            if (GAdaptiveFramePacing)
+            {
+                FramePacer.WaitUntil(WaitEndTime);
+            }
+            else
+            {
+                const double WaitTime = WaitEndTime - FPlatformTime::Seconds();
+                if (WaitTime > 0.0)
+                {
+                    FPlatformProcess::SleepNoStats((float)WaitTime);
+                }
+            }
+        }
+
+        //...
     }
 
     /** kwakkh
@@ -173,8 +441,24 @@ class UEngine : public UObject, public FExec
      * - WorldContext를 관리하고 생성, 파괴의 주체는 엔진이다.
      */
     // see FWorldContext
-    TIndirectArray<FWorldContext> WorldList;
+    // kwakkh : TIndirectArray 대신 FWorldContextList를 사용 (see FWorldContextList)
+    FWorldContextList WorldList;
     int32 NextWorldContextHandle;
+
+    /** true면 UpdateTimeAndHandleMaxTickRate에서 최대 틱 레이트 대기를 건너뛴다. 임베디드 배치 틱(EngineTickBatch) 동안만 설정된다 */
+    bool bSkipMaxTickRateWait = false;
+
+    /** 최대 틱 레이트 대기를 처리하는 프레임 페이서 (GAdaptiveFramePacing) */
+    FFramePacer FramePacer;
+
+    /** 
+     * kwakkh : WorldList를 선형 탐색하지 않기 위한 색인(index)들
+     * - CreateNewWorldContext, FWorldContext::SetCurrentWorld / SetWorldType, DestroyWorldContext에서 WorldList와 함께 갱신된다.
+     * - FWorldContext는 FWorldContextList의 슬랩에 할당되어 주소가 바뀌지 않으므로, 포인터를 들고 있어도 안전하다.
+     */
+    TMap<const UWorld*, FWorldContext*> WorldContextsByWorld;
+    TMap<FName, FWorldContext*> WorldContextsByHandle;
+    TArray<FWorldContext*> WorldContextsByType[EWorldType::Num];
 }
 
 // 10 - Foundation - Entry - UEditorEngine
@@ -200,13 +484,12 @@ public:
          * - 언리얼 Editor 월드가 존재하지 않으면 Editor에서 어떤 것도 진행 불가이기 때문에 1개는 반드시 보장되어야 한다.
          */
 
-        for (int32 i=0; i < WorldList.Num(); ++i)
+        // kwakkh : 매 Tick마다 불리므로 WorldList 전체를 훑지 않고, 타입별 색인에서 첫 번째 Editor 컨텍스트를 바로 꺼낸다.
+        TArrayView<FWorldContext* const> EditorContexts = GetWorldContextsOfType(EWorldType::Editor);
+        if (EditorContexts.Num() > 0)
         {
-            if (WorldList[i].WorldType == EWorldType::Editor)
-            {
-                ensure(!bEnsureIsGWorld || WorldList[i].World() == GWorld);
-                return WorldList[i];
-            }
+            ensure(!bEnsureIsGWorld || EditorContexts[0]->World() == GWorld);
+            return *EditorContexts[0];
         }
 
         /**
@@ -0,0 +1,193 @@
+/**
+ * kwakkh
+ * - UEngine::UpdateTimeAndHandleMaxTickRate에서 최대 틱 레이트(MaxTickRate)를 지키기 위해 기다리는 부분을 대신하는 프레임 페이서(pacer)
+ * - 기존 방식은 남은 시간만큼 FPlatformProcess::Sleep을 호출한다.
+ *   - OS 스케줄러의 깨우기 정밀도(수 ms) 때문에 목표 시간보다 늦게 깨어나는 일이 잦다. (틱 지터)
+ *   - 자는 동안 코어는 아무 일도 하지 않는다.
+ */
+
+/**
+ * 0이 아니면 UEngine::UpdateTimeAndHandleMaxTickRate의 대기를 FFramePacer로 처리한다.
+ * (t.AdaptiveFramePacing 콘솔 변수로 제어)
+ */
+extern ENGINE_API int32 GAdaptiveFramePacing;
+
+/** 프레임 페이싱 오차 통계. 오차 == 실제로 깨어난 시간 - 목표 시간 (양수면 늦게 깨어남) */
+struct FFramePacingStats
+{
+    double LastErrorSeconds = 0.0;
+    double MeanAbsErrorSeconds = 0.0;
+    double MaxErrorSeconds = 0.0;
+
+    /** 프레임 작업 자체가 목표 시간을 넘겨서 기다리지 못한 프레임 수 */
+    int32 NumLateFrames = 0;
+    int32 NumFrames = 0;
+
+    /** 마지막 프레임의 유휴 시간 중 백그라운드 작업에 쓴 시간 */
+    double LastIdleWorkSeconds = 0.0;
+
+    /** 예측한 프레임 비용이 예산에 가까워서 유휴 작업을 건너뛴 프레임 수 */
+    int32 NumIdleWorkSkippedFrames = 0;
+};
+
+/**
+ * 하이브리드 sleep/spin 대기를 사용하는 프레임 페이서.
+ *
+ * kwakkh
+ * - 대기는 세 구간으로 나뉜다.
+ *   1. 유휴 작업: 목표 시간까지 충분히 남았으면 등록된 백그라운드 작업(GC 단계, 점진적 등록 등)을 실행한다.
+ *   2. Sleep: 목표 시간 SpinThreshold 전까지는 OS에 양보한다.
+ *   3. Spin: 마지막 SpinThreshold 동안은 바쁜 대기(YieldThread)로 정확하게 깨어난다.
+ * - 유휴 작업의 마감은 실제로 남은 시간으로 정한다. WaitUntil이 불릴 때는 이번 프레임의 작업이 이미 끝났으므로 남은 시간을 정확히 알 수 있다.
+ * - 유휴 작업을 할지 말지는 예측한 프레임 비용(실제 프레임 작업 시간의 지수 이동 평균)으로 정한다.
+ *   - 예측 비용이 프레임 예산의 (1 - IdleWorkMinHeadroomFraction)를 넘으면 이번 유휴 시간은 sleep/spin에만 쓴다.
+ *   - 예산에 가깝게 도는 서버에서는 이번 프레임이 우연히 일찍 끝났을 뿐 다음 프레임은 늦기 쉽다.
+ *     이때 유휴 작업(GC 정리 등)이 캐시를 밀어내거나 마감을 넘기면 그대로 다음 프레임의 지연이 된다.
+ *   - 건너뛴 GC 정리는 기존처럼 프레임 안의 점진적 정리 경로에서 처리된다.
+ *
+ *  Diagram:
+ *    |── frame work ──|── idle work ──|── sleep ──|─ spin ─|
+ *    FrameStart                                               Target-Spin  Target
+ */
+class FFramePacer
+{
+public:
+    /**
+     * 유휴 시간에 실행할 작업. Deadline(FPlatformTime::Seconds 기준)까지 일을 하고, 아직 남은 일이 있으면 true를 반환해야 한다.
+     * 한 번의 호출이 Deadline을 크게 넘기지 않도록 작은 단위로 끊어서 처리해야 한다.
+     */
+    using FIdleWork = TFunction<bool(double Deadline)>;
+
+    void AddIdleWork(FName Name, FIdleWork&& Work)
+    {
+        IdleWorks.Add({ Name, MoveTemp(Work) });
+    }
+
+    void RemoveIdleWork(FName Name)
+    {
+        IdleWorks.RemoveAll([Name](const FIdleWorkEntry& Entry) { return Entry.Name == Name; });
+    }
+
+    /**
+     * TargetTime(FPlatformTime::Seconds 기준)까지 기다린다. 게임 스레드에서 프레임마다 한 번 호출한다.
+     * 호출 시점까지가 이번 프레임의 작업 시간으로 간주되어 프레임 비용 예측에 반영된다.
+     */
+    void WaitUntil(double TargetTime)
+    {
+        const double WaitStartTime = FPlatformTime::Seconds();
+        if (FrameStartTime > 0.0)
+        {
+            const double FrameCost = WaitStartTime - FrameStartTime;
+            EstimatedFrameCostSeconds = (EstimatedFrameCostSeconds == 0.0) ? FrameCost : FMath::Lerp(EstimatedFrameCostSeconds, FrameCost, FrameCostSmoothing);
+        }
+
+        Stats.LastIdleWorkSeconds = 0.0;
+        if (WaitStartTime >= TargetTime)
+        {
+            // 이미 늦었다 - 기다리지 않는다
+            ++Stats.NumLateFrames;
+            RecordError(WaitStartTime - TargetTime);
+            FrameStartTime = FPlatformTime::Seconds();
+            return;
+        }
+
+        // 1. 유휴 작업: 예측한 프레임 비용에 여유가 있을 때만, sleep/spin 구간과 안전 여유를 남긴 시점까지
+        if (HasIdleWorkHeadroom(TargetTime))
+        {
+            const double IdleWorkDeadline = TargetTime - SpinThresholdSeconds - IdleWorkSafetyMarginSeconds;
+            RunIdleWork(IdleWorkDeadline);
+        }
+        else
+        {
+            ++Stats.NumIdleWorkSkippedFrames;
+        }
+
+        // 2. Sleep
+        double Remaining = TargetTime - FPlatformTime::Seconds();
+        if (Remaining > SpinThresholdSeconds)
+        {
+            FPlatformProcess::SleepNoStats((float)(Remaining - SpinThresholdSeconds));
+        }
+
+        // 3. Spin
+        while (FPlatformTime::Seconds() < TargetTime)
+        {
+            FPlatformProcess::YieldThread();
+        }
+
+        const double WakeTime = FPlatformTime::Seconds();
+        RecordError(WakeTime - TargetTime);
+        FrameStartTime = WakeTime;
+    }
+
+    /** 최근 프레임 작업 비용의 지수 이동 평균 (초). 유휴 작업을 할지 정하는 데 쓴다 */
+    double GetEstimatedFrameCost() const { return EstimatedFrameCostSeconds; }
+
+    const FFramePacingStats& GetStats() const { return Stats; }
+
+    /** Sleep의 깨우기 오차를 흡수하기 위해 바쁜 대기로 보내는 시간 */
+    double SpinThresholdSeconds = 0.002;
+
+    /** 유휴 작업이 Deadline을 조금 넘기더라도 sleep/spin 구간을 침범하지 않도록 남겨두는 여유 */
+    double IdleWorkSafetyMarginSeconds = 0.0005;
+
+    /** 프레임 비용 예측의 지수 이동 평균 계수 (클수록 최근 프레임을 더 크게 반영) */
+    double FrameCostSmoothing = 0.1;
+
+    /** 예측한 프레임 비용을 빼고 프레임 예산에 이 비율 이상 여유가 있어야 유휴 작업을 실행한다 */
+    double IdleWorkMinHeadroomFraction = 0.1;
+
+private:
+    struct FIdleWorkEntry
+    {
+        FName Name;
+        FIdleWork Work;
+    };
+
+    /** 프레임 예산(이전 프레임 시작 -> TargetTime)에서 예측한 프레임 비용을 빼고도 충분한 여유가 남는지 */
+    bool HasIdleWorkHeadroom(double TargetTime) const
+    {
+        if (FrameStartTime <= 0.0 || EstimatedFrameCostSeconds <= 0.0)
+        {
+            // 아직 예측값이 없다 - 남은 시간만 보고 실행한다
+            return true;
+        }
+
+        const double FrameBudgetSeconds = TargetTime - FrameStartTime;
+        return FrameBudgetSeconds - EstimatedFrameCostSeconds >= FrameBudgetSeconds * IdleWorkMinHeadroomFraction;
+    }
+
+    /** 등록된 유휴 작업들을 Deadline까지 라운드 로빈으로 실행. 모든 작업이 끝났다고 하면 일찍 멈춘다 */
+    void RunIdleWork(double Deadline)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        int32 NumIdleSinceLastWork = 0;
+        while (IdleWorks.Num() > 0 && NumIdleSinceLastWork < IdleWorks.Num() && FPlatformTime::Seconds() < Deadline)
+        {
+            NextIdleWorkIndex = NextIdleWorkIndex % IdleWorks.Num();
+            const bool bHasMoreWork = IdleWorks[NextIdleWorkIndex].Work(Deadline);
+            NumIdleSinceLastWork = bHasMoreWork ? 0 : NumIdleSinceLastWork + 1;
+            ++NextIdleWorkIndex;
+        }
+        Stats.LastIdleWorkSeconds = FPlatformTime::Seconds() - StartTime;
+    }
+
+    void RecordError(double ErrorSeconds)
+    {
+        ++Stats.NumFrames;
+        Stats.LastErrorSeconds = ErrorSeconds;
+        Stats.MaxErrorSeconds = FMath::Max(Stats.MaxErrorSeconds, ErrorSeconds);
+        Stats.MeanAbsErrorSeconds += (FMath::Abs(ErrorSeconds) - Stats.MeanAbsErrorSeconds) / Stats.NumFrames;
+
+        CSV_CUSTOM_STAT_GLOBAL(FramePacingErrorMs, (float)(ErrorSeconds * 1000.0), ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT_GLOBAL(FramePacingIdleWorkMs, (float)(Stats.LastIdleWorkSeconds * 1000.0), ECsvCustomStatOp::Set);
+        CSV_CUSTOM_STAT_GLOBAL(FramePacingEstimatedFrameCostMs, (float)(EstimatedFrameCostSeconds * 1000.0), ECsvCustomStatOp::Set);
+    }
+
+    TArray<FIdleWorkEntry> IdleWorks;
+    int32 NextIdleWorkIndex = 0;
+
+    double FrameStartTime = 0.0;
+    double EstimatedFrameCostSeconds = 0.0;
+    FFramePacingStats Stats;
+};
@@ -0,0 +1,304 @@
+/**
+ * kwakkh
+ * - 게임 스레드와 그 소비자(렌더 스레드)를 N 프레임 깊이로 파이프라이닝하는 모드
+ * - 기존 방식은 UpdateTimeAndHandleMaxTickRate의 FrameNumber 동기화로 게임 스레드와 렌더 스레드를 거의 lockstep으로 묶는다.
+ *   - 게임 스레드는 렌더 스레드가 직전 프레임을 끝낼 때까지 기다린다. (처리량 손해, 지연 이득)
+ * - 파이프라인 모드에서는 게임 스레드가 최대 N 프레임까지 소비자보다 앞서 나갈 수 있다. (처리량 이득, 지연 손해)
+ * - 소비자는 항상 정확히 하나다.
+ *   - 기본: 렌더 스레드. 게임 스레드가 패킷을 제출할 때마다 그 패킷을 소비하는 렌더 커맨드를 하나씩 넣는다. (see EnqueueRenderThreadFrameConsume)
+ *   - GFramePipelineHeadless: 렌더 스레드 대신 FHeadlessFrameConsumer 스레드
+ * - 렌더 스레드가 소비자일 때는 깊이가 1로 제한된다.
+ *   - FEngineLoop::Tick 끝의 FFrameEndSync가 게임 스레드를 렌더 스레드보다 최대 한 프레임(r.OneFrameThreadLag)만 앞서게 묶기 때문이다.
+ *   - 그보다 깊게 하려면 FFrameEndSync를 파이프라인의 back pressure로 대체해야 하는데, 렌더 스레드 쪽 프레임 자원(RHI 커맨드 리스트, 씬 업데이트 등)이
+ *     한 프레임 지연만 가정하고 있어서 여기서는 하지 않는다. 깊이 > 1은 헤드리스 소비자로 측정한다.
+ */
+
+/**
+ * 0이면 기존 lockstep 동작, N > 0이면 게임 스레드가 소비자보다 최대 N 프레임 앞서 나갈 수 있다.
+ * (r.FramePipelineDepth 콘솔 변수로 제어, 최대 FFramePipeline::MaxDepth. 렌더 스레드가 소비자면 FFrameEndSync 때문에 1로 제한된다)
+ */
+extern ENGINE_API int32 GFramePipelineDepth;
+
+/**
+ * 0이 아니면 렌더 스레드 대신 헤드리스 소비자(FHeadlessFrameConsumer)가 프레임 패킷을 소비한다. (-HeadlessFramePipeline)
+ * - GPU 없이 파이프라인 깊이에 따른 지연/처리량을 측정하기 위한 용도
+ */
+extern ENGINE_API int32 GFramePipelineHeadless;
+
+/** 헤드리스 소비자가 프레임 패킷 하나를 처리하는 데 걸리는 시간을 흉내내는 값 (ms) */
+extern ENGINE_API float GFramePipelineHeadlessCostMs;
+
+/** 게임 스레드가 한 프레임 동안 만든 결과를 소비자에게 넘기는 단위 */
+struct FFramePacket
+{
+    /** 이 패킷을 만든 게임 스레드 프레임 번호 (GFrameCounter) */
+    uint64 FrameNumber = 0;
+
+    float DeltaTime = 0.f;
+
+    /** 게임 스레드가 패킷을 제출한 시간 (FPlatformTime::Seconds) */
+    double SubmitTime = 0.0;
+
+    /** 소비자가 이 패킷을 실행할 작업 (렌더 커맨드 목록 등). 헤드리스 소비자는 비어 있어도 된다 */
+    TArray<TUniqueFunction<void()>> Commands;
+};
+
+/** 파이프라인 통계. 지연 == 패킷 제출 ~ 소비 완료 시간. FFramePipeline::GetStats로 복사본을 얻는다 */
+struct FFramePipelineStats
+{
+    double LastLatencySeconds = 0.0;
+    double MeanLatencySeconds = 0.0;
+    double MaxLatencySeconds = 0.0;
+
+    /** 파이프라인이 가득 차서 게임 스레드가 기다린 누적 시간 */
+    double ProducerStallSeconds = 0.0;
+
+    /** 소비자가 패킷을 기다린 누적 시간 */
+    double ConsumerStarveSeconds = 0.0;
+
+    uint64 NumFramesConsumed = 0;
+
+    /** 통계를 리셋한 이후의 소비 처리량 (frames / second) */
+    double GetThroughput(double Now) const
+    {
+        const double Elapsed = Now - StartTime;
+        return Elapsed > 0.0 ? (double)NumFramesConsumed / Elapsed : 0.0;
+    }
+
+    double StartTime = 0.0;
+};
+
+/**
+ * 단일 생산자(게임 스레드) / 단일 소비자 프레임 패킷 링 버퍼.
+ *
+ * kwakkh
+ * - 슬롯 수는 MaxDepth로 고정되어 있고, 실제 깊이(Depth)만큼만 사용한다.
+ * - 생산자는 BeginFrame으로 슬롯을 얻어 채운 뒤 SubmitFrame으로 넘긴다.
+ *   - 제출된 프레임 수 - 소비 완료 프레임 수 == Depth 이면 가득 찬 것이므로 BeginFrame에서 기다린다. (back pressure)
+ * - 소비자는 AcquireFrame / ReleaseFrame 쌍으로 패킷을 처리한다.
+ *
+ *  Diagram: (Depth == 3)
+ *    Slots:  [ F5 (consuming) ][ F6 (submitted) ][ F7 (game thread filling) ]
+ *                  ^ ConsumedCount                        ^ SubmittedCount
+ */
+class FFramePipeline
+{
+public:
+    static constexpr int32 MaxDepth = 8;
+
+    FFramePipeline()
+        : SlotFreedEvent(EEventMode::AutoReset)
+        , SlotSubmittedEvent(EEventMode::AutoReset)
+    {
+        Stats.StartTime = FPlatformTime::Seconds();
+    }
+
+    /** 파이프라인 깊이 변경. 파이프라인이 비어 있을 때(Flush 이후)만 호출해야 한다 */
+    void SetDepth(int32 InDepth)
+    {
+        check(IsEmpty());
+        Depth = FMath::Clamp(InDepth, 1, MaxDepth);
+    }
+
+    int32 GetDepth() const { return Depth; }
+
+    bool IsEmpty() const
+    {
+        return SubmittedCount.load(std::memory_order_acquire) == ConsumedCount.load(std::memory_order_acquire);
+    }
+
+    /** [Game Thread] 다음 패킷 슬롯을 얻는다. 파이프라인이 가득 찼으면 소비자가 한 프레임을 끝낼 때까지 기다린다 */
+    FFramePacket& BeginFrame()
+    {
+        const uint64 Submitted = SubmittedCount.load(std::memory_order_relaxed);
+        if (Submitted - ConsumedCount.load(std::memory_order_acquire) >= (uint64)Depth)
+        {
+            const double StallStartTime = FPlatformTime::Seconds();
+            while (Submitted - ConsumedCount.load(std::memory_order_acquire) >= (uint64)Depth)
+            {
+                SlotFreedEvent->Wait();
+            }
+
+            FScopeLock Lock(&StatsLock);
+            Stats.ProducerStallSeconds += FPlatformTime::Seconds() - StallStartTime;
+        }
+
+        FFramePacket& Packet = Slots[Submitted % MaxDepth];
+        Packet.Commands.Reset();
+        return Packet;
+    }
+
+    /** [Game Thread] BeginFrame으로 얻은 패킷을 소비자에게 넘긴다 */
+    void SubmitFrame(uint64 FrameNumber, float DeltaTime)
+    {
+        const uint64 Submitted = SubmittedCount.load(std::memory_order_relaxed);
+        FFramePacket& Packet = Slots[Submitted % MaxDepth];
+        Packet.FrameNumber = FrameNumber;
+        Packet.DeltaTime = DeltaTime;
+        Packet.SubmitTime = FPlatformTime::Seconds();
+
+        SubmittedCount.store(Submitted + 1, std::memory_order_release);
+        SlotSubmittedEvent->Trigger();
+    }
+
+    /** [Consumer] 다음 패킷을 얻는다. 제출된 패킷이 없으면 WaitMs 만큼 기다리고, 그래도 없으면 nullptr */
+    FFramePacket* AcquireFrame(uint32 WaitMs)
+    {
+        const uint64 Consumed = ConsumedCount.load(std::memory_order_relaxed);
+        if (SubmittedCount.load(std::memory_order_acquire) == Consumed)
+        {
+            const double StarveStartTime = FPlatformTime::Seconds();
+            SlotSubmittedEvent->Wait(WaitMs);
+            {
+                FScopeLock Lock(&StatsLock);
+                Stats.ConsumerStarveSeconds += FPlatformTime::Seconds() - StarveStartTime;
+            }
+
+            if (SubmittedCount.load(std::memory_order_acquire) == Consumed)
+            {
+                return nullptr;
+            }
+        }
+        return &Slots[Consumed % MaxDepth];
+    }
+
+    /** [Consumer] AcquireFrame으로 얻은 패킷 처리를 끝내고 슬롯을 반환한다 */
+    void ReleaseFrame(const FFramePacket& Packet)
+    {
+        const double Latency = FPlatformTime::Seconds() - Packet.SubmitTime;
+        {
+            FScopeLock Lock(&StatsLock);
+            ++Stats.NumFramesConsumed;
+            Stats.LastLatencySeconds = Latency;
+            Stats.MaxLatencySeconds = FMath::Max(Stats.MaxLatencySeconds, Latency);
+            Stats.MeanLatencySeconds += (Latency - Stats.MeanLatencySeconds) / (double)Stats.NumFramesConsumed;
+        }
+
+        // kwakkh : 기존 lockstep의 FrameNumber 동기화 대신, 소비자가 마지막으로 끝낸 게임 프레임 번호를 기록
+        LastConsumedFrameNumber.store(Packet.FrameNumber, std::memory_order_relaxed);
+
+        ConsumedCount.fetch_add(1, std::memory_order_release);
+        SlotFreedEvent->Trigger();
+    }
+
+    /** [Game Thread] 제출된 패킷이 모두 소비될 때까지 기다린다 (깊이 변경, 레벨 전환, 종료 등) */
+    void Flush()
+    {
+        while (!IsEmpty())
+        {
+            SlotFreedEvent->Wait(1);
+        }
+    }
+
+    /** 소비자가 마지막으로 끝낸 게임 프레임 번호. 게임 스레드와의 차이가 현재 파이프라인에 쌓인 프레임 수 */
+    uint64 GetLastConsumedFrameNumber() const { return LastConsumedFrameNumber.load(std::memory_order_relaxed); }
+
+    /** 통계는 게임 스레드와 소비자가 함께 갱신하므로 락을 잡고 복사본을 돌려준다 (프레임당 몇 번뿐이라 락 비용은 무시할 만하다) */
+    FFramePipelineStats GetStats() const
+    {
+        FScopeLock Lock(&StatsLock);
+        return Stats;
+    }
+
+    void ResetStats()
+    {
+        FScopeLock Lock(&StatsLock);
+        Stats = FFramePipelineStats();
+        Stats.StartTime = FPlatformTime::Seconds();
+    }
+
+private:
+    FFramePacket Slots[MaxDepth];
+    int32 Depth = 1;
+
+    std::atomic<uint64> SubmittedCount = 0;
+    std::atomic<uint64> ConsumedCount = 0;
+    std::atomic<uint64> LastConsumedFrameNumber = 0;
+
+    FEventRef SlotFreedEvent;
+    FEventRef SlotSubmittedEvent;
+
+    mutable FCriticalSection StatsLock;
+    FFramePipelineStats Stats;
+};
+
+/**
+ * [Game Thread] 방금 제출한 패킷 하나를 렌더 스레드에서 소비하는 렌더 커맨드를 넣는다. (렌더 스레드가 소비자일 때 SubmitFrame 직후 호출)
+ * kwakkh
+ * - 패킷 하나당 렌더 커맨드 하나이고 렌더 커맨드는 제출 순서대로 실행되므로, 렌더 스레드는 항상 다음 패킷이 이미 제출된 상태에서 AcquireFrame을 호출한다.
+ * - 렌더 스레드가 없으면(GIsThreadedRendering == false) 커맨드가 게임 스레드에서 바로 실행되어, 파이프라인이 쌓이지 않고 lockstep처럼 동작한다.
+ */
+inline void EnqueueRenderThreadFrameConsume(FFramePipeline& Pipeline)
+{
+    ENQUEUE_RENDER_COMMAND(ConsumeFramePacket)([&Pipeline](FRHICommandListImmediate& RHICmdList)
+    {
+        FFramePacket* Packet = Pipeline.AcquireFrame(0);
+        check(Packet);
+
+        for (TUniqueFunction<void()>& Command : Packet->Commands)
+        {
+            Command();
+        }
+
+        Pipeline.ReleaseFrame(*Packet);
+    });
+}
+
+/**
+ * 렌더 스레드를 대신해 FFramePipeline의 패킷을 소비하는 헤드리스 소비자.
+ * - 패킷의 Commands를 실행한 뒤 GFramePipelineHeadlessCostMs 만큼 바쁜 대기로 렌더링 비용을 흉내낸다.
+ */
+class FHeadlessFrameConsumer : public FRunnable
+{
+public:
+    explicit FHeadlessFrameConsumer(FFramePipeline& InPipeline)
+        : Pipeline(InPipeline)
+    {
+        Thread = FRunnableThread::Create(this, TEXT("HeadlessFrameConsumer"), 0, TPri_AboveNormal);
+    }
+
+    virtual ~FHeadlessFrameConsumer() override
+    {
+        if (Thread)
+        {
+            Thread->Kill(true);
+            delete Thread;
+        }
+    }
+
+    virtual uint32 Run() override
+    {
+        while (!bStopRequested.load(std::memory_order_relaxed))
+        {
+            FFramePacket* Packet = Pipeline.AcquireFrame(10);
+            if (!Packet)
+            {
+                continue;
+            }
+
+            for (TUniqueFunction<void()>& Command : Packet->Commands)
+            {
+                Command();
+            }
+
+            const double CostEndTime = FPlatformTime::Seconds() + GFramePipelineHeadlessCostMs * 0.001;
+            while (FPlatformTime::Seconds() < CostEndTime)
+            {
+                FPlatformProcess::YieldThread();
+            }
+
+            Pipeline.ReleaseFrame(*Packet);
+        }
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStopRequested.store(true, std::memory_order_relaxed);
+    }
+
+private:
+    FFramePipeline& Pipeline;
+    FRunnableThread* Thread = nullptr;
+    std::atomic<bool> bStopRequested = false;
+};
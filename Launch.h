@@ -4,6 +4,7 @@
  */
 
 #include "LaunchEngineLoop.h"
+#include "BootProfiler.h"
 
 /** FPlatformTime::Seconds()가 처음 초기화된 시간 (before main)
  * CoreGlobals.cpp 에 정의된 전역 변수
@@ -20,6 +21,7 @@ double GStartTime = FPlatformTime::InitTiming();
 // Kwakkh : 언리얼 엔진에서 메인 루프의 초기화를 시작하는 함수
 int32 EnginePreInit( const TCHAR* CmdLine )
 {
+	BOOT_PROFILER_SCOPE("EnginePreInit");
 	int32 ErrorLevel = GEngineLoop.PreInit( CmdLine );
 	return( ErrorLevel );
 }
@@ -27,6 +29,7 @@ int32 EnginePreInit( const TCHAR* CmdLine )
 // 7 - Foundation - Entry - EditorInit
 int32 EditorInit(IEngineLoop& EngineLoop)
 {
+	BOOT_PROFILER_SCOPE("EditorInit");
     //...
 }
 
@@ -40,6 +43,60 @@ LAUNCH_API void EngineTick( void )
 	GEngineLoop.Tick();
 }
 
+/** EngineTickBatch 결과. 루프 오버헤드 == 배치 전체 시간 - GEngine->Tick에 쓴 시간 */
+struct FEngineTickBatchStats
+{
+	int32 NumTicksRun = 0;
+	double WallSeconds = 0.0;
+	double EngineTickSeconds = 0.0;
+
+	double GetLoopOverheadMicrosecondsPerTick() const
+	{
+		return NumTicksRun > 0 ? (WallSeconds - EngineTickSeconds) * 1000000.0 / NumTicksRun : 0.0;
+	}
+};
+
+/**
+ * 임베디드 모드(GUELibraryOverrideSettings.bIsEmbedded)에서 호스트가 엔진을 NumTicks번 연속으로 진행시킨다.
+ * - 매 틱은 FixedDeltaSeconds만큼의 시간만 진행하고, 벽시계에 맞추기 위한 대기(최대 틱 레이트)는 하지 않는다.
+ * - 종료 요청이 들어오면 배치 중간이라도 멈춘다.
+ *
+ * kwakkh
+ * - GEngine, GEngineLoop, GWorld 등은 프로세스 전역 싱글톤이므로 한 프로세스에는 엔진 인스턴스가 하나뿐이다.
+ * - 항상 엔진의 게임 스레드(GGameThreadId, 엔진을 초기화한 스레드)에서만 호출해야 한다. (EngineTick과 같은 조건, check)
+ *   - 호스트 스레드 풀의 아무 스레드에서나 호출할 수 없다. 스레드 풀을 쓴다면 엔진을 초기화한 스레드 하나를 엔진 전용으로 고정한다.
+ *   - 여러 시뮬레이션을 병렬로 돌리려면 엔진 프로세스를 여러 개 띄운다. (UWorld::Tick은 게임 스레드 전용)
+ */
+LAUNCH_API FEngineTickBatchStats EngineTickBatch(int32 NumTicks, float FixedDeltaSeconds)
+{
+	check(IsInGameThread());
+	check(NumTicks >= 0 && FixedDeltaSeconds > 0.f);
+
+	// kwakkh : check 매크로는 shipping에서 식 자체가 사라지므로, 플래그 설정은 check 밖에서 한다
+	static std::atomic<bool> bTickBatchInProgress = false;
+	const bool bWasInProgress = bTickBatchInProgress.exchange(true);
+	checkf(!bWasInProgress, TEXT("EngineTickBatch is not reentrant: engine globals are process-wide singletons"));
+
+	// 배치 동안만 고정 틱 + 대기 없음으로 바꾸고, 끝나면 호스트가 설정해 둔 값으로 되돌린다 (고정 틱 가속 모드 전환은 배치 뒤로 미뤄진다)
+	GEngineLoop.BeginTickBatch(FixedDeltaSeconds);
+
+	FEngineTickBatchStats Stats;
+	uint64 EngineTickCycles = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (; Stats.NumTicksRun < NumTicks && !IsEngineExitRequested(); ++Stats.NumTicksRun)
+	{
+		GEngineLoop.Tick();
+		EngineTickCycles += GEngineLoop.GetLastEngineTickCycles();
+	}
+	Stats.WallSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	Stats.EngineTickSeconds = FPlatformTime::ToSeconds64(EngineTickCycles);
+
+	GEngineLoop.EndTickBatch();
+
+	bTickBatchInProgress.store(false);
+	return Stats;
+}
+
 /**
  * Shuts down the engine
  */
@@ -61,6 +118,52 @@ int32 GuardedMain( const TCHAR* CmdLine )
 {
 	//....
 
+	/** kwakkh
+	 * - "-BootProfile[=<파일 경로>]"가 있으면 부트 프로파일러를 가능한 한 일찍 켠다. (see FBootProfiler)
+	 * - GuardedMain 스코프는 아래 초기화가 끝나는 지점에서 닫히도록 Optional로 들고 있다.
+	 */
+	FString BootProfileFilename;
+	const bool bBootProfile = FParse::Param(CmdLine, TEXT("BootProfile")) || FParse::Value(CmdLine, TEXT("BootProfile="), BootProfileFilename);
+	if (bBootProfile)
+	{
+		FBootProfiler::Get().Start();
+	}
+
+	// kwakkh : 스타트업 태스크 그래프 병렬 실행 (see GStartupTaskGraphParallel)
+	if (FParse::Param(CmdLine, TEXT("StartupTaskParallel")))
+	{
+		GStartupTaskGraphParallel = 1;
+	}
+
+	// kwakkh : 스타트업 태스크 그래프 검증 모드. 값이 있으면 그 시드로 섞고, 없으면 역순으로 실행한다. (see GStartupTaskGraphValidation)
+	if (FParse::Value(CmdLine, TEXT("StartupTaskValidation="), GStartupTaskGraphValidationSeed))
+	{
+		GStartupTaskGraphValidation = 2;
+	}
+	else if (FParse::Param(CmdLine, TEXT("StartupTaskValidation")))
+	{
+		GStartupTaskGraphValidation = 1;
+	}
+
+	TOptional<FBootProfilerScope> GuardedMainBootScope;
+	GuardedMainBootScope.Emplace(TEXT("GuardedMain"));
+
+	// kwakkh : GuardedMain 스코프를 닫고 트레이스를 저장한 뒤 프로파일러를 끈다. 초기화가 끝났을 때와 PreInit 실패로 일찍 빠져나갈 때 모두 호출
+	auto FinishBootProfile = [&GuardedMainBootScope, bBootProfile, &BootProfileFilename]()
+	{
+		GuardedMainBootScope.Reset();
+		if (bBootProfile)
+		{
+			if (BootProfileFilename.IsEmpty())
+			{
+				BootProfileFilename = FPaths::ProfilingDir() / TEXT("BootProfile.json");
+			}
+			FBootProfiler::Get().LogSummary();
+			FBootProfiler::Get().WriteChromeTrace(BootProfileFilename);
+			FBootProfiler::Get().Stop();
+		}
+	};
+
 #if !(UE_BUILD_SHIPPING)
 
 	// "-waitforattach" 또는 "-WaitForDebugger"가 지정된 경우 시작을 중지하고 디버거가 연결될 때까지 기다렸다가 계속 진행
@@ -95,6 +198,7 @@ int32 GuardedMain( const TCHAR* CmdLine )
 #endif
 
 	BootTimingPoint("DefaultMain");
+	FBootProfiler::Get().Mark(TEXT("DefaultMain"));
 
 	// Super early init code. DO NOT MOVE THIS ANYWHERE ELSE!
     /**
@@ -106,7 +210,17 @@ int32 GuardedMain( const TCHAR* CmdLine )
      * - 언리얼 엔진은 위와 같이 위임자 클래스를 증명하는 형태로 코드를 주입하는 방법을 제공
      * - 여기서 언리얼 엔진의 시작 지점에 코드를 삽입할 수 있다
      */
-	FCoreDelegates::GetPreMainInitDelegate().Broadcast();
+	{
+		BOOT_PROFILER_SCOPE("PreMainInitDelegate");
+		FCoreDelegates::GetPreMainInitDelegate().Broadcast();
+	}
+	{
+		// kwakkh : PreMainInit 델리게이트 대신 의존성을 선언해서 등록된 태스크들 (see FStartupTaskGraph)
+		// - 태스크 워커가 시작되기 전이므로 GStartupTaskGraphParallel이어도 메인 스레드에서 직렬로 실행된다
+		// - 기존 PreMainInit 델리게이트 바인딩은 위의 Broadcast에 그대로 남아 있다. 태스크로 옮긴 바인딩만 여기서 실행된다
+		BOOT_PROFILER_SCOPE("PreMainInitTasks");
+		FStartupTaskGraph::Get(EStartupPhase::PreMainInit).Run(TEXT("PreMainInit"));
+	}
 
 	// make sure GEngineLoop::Exit() is always called.
 	/** kwakkh
@@ -134,6 +248,8 @@ int32 GuardedMain( const TCHAR* CmdLine )
 	// exit if PreInit failed.
 	if ( ErrorLevel != 0 || IsEngineExitRequested() )
 	{
+		// kwakkh : 실패한 부트일수록 트레이스가 필요하므로 여기서도 저장한다
+		FinishBootProfile();
 		return ErrorLevel;
 	}
 
@@ -146,6 +262,7 @@ int32 GuardedMain( const TCHAR* CmdLine )
 		SlowTask.EnterProgressFrame(80);
 
 		SlowTask.EnterProgressFrame(20);
+		BOOT_PROFILER_SCOPE("EngineInit_SlowTask");
 
 #if WITH_EDITOR
 		if (GIsEditor)
@@ -159,6 +276,7 @@ int32 GuardedMain( const TCHAR* CmdLine )
 		else
 #endif
 		{
+			BOOT_PROFILER_SCOPE("EngineInit");
 			ErrorLevel = EngineInit();
 		}
 	}
@@ -167,11 +285,15 @@ int32 GuardedMain( const TCHAR* CmdLine )
     // FPlatformTime::Seconds() 는 초 단위의 double 값이 나옮
     // GStartTime : FPlatformTime::Seconds()가 처음 초기화된 시간 (언리얼 시작 타임을 캐싱한 변수) 
 	double EngineInitializationTime = FPlatformTime::Seconds() - GStartTime;
+
+	// kwakkh : 초기화가 끝났으므로 트레이스를 저장하고 프로파일러를 끈다. (메인 루프는 측정하지 않는다)
+	FinishBootProfile();
 	
     //...
 
 	// Don't tick if we're running an embedded engine - we rely on the outer
 	// application ticking us instead.
+	// kwakkh : 호스트는 EngineTick 한 번씩, 또는 EngineTickBatch로 고정 델타 N틱을 한 번에 진행시킨다
 	if (!GUELibraryOverrideSettings.bIsEmbedded)
 	{
         // kwakkh : IsEngineExitRequested() == GIsRequestingExit
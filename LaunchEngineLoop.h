@@ -1,7 +1,18 @@
 #include "EditorEngine.h"
+#include "FramePipeline.h"
+#include "StartupTaskGraph.h"
 
 ENGINE_API UEngin* GEngine = NULL;
 
+/**
+ * 0보다 크면 고정 틱 가속 모드. 매 틱 이 값(초)만큼 시뮬레이션 시간을 진행하고, 벽시계에 맞추기 위해 기다리지 않는다. (-FixedStepAccelerated=<DeltaSeconds>)
+ * - 리플레이 검증, AI 학습처럼 실시간보다 빠르게 돌려야 하는 서버/헤드리스 실행용
+ */
+extern ENGINE_API float GFixedStepAcceleratedDeltaTime;
+
+/** 고정 틱 가속 모드의 처리량(시뮬레이션 초 / 벽시계 초)을 로그로 남기는 간격 (벽시계 초) */
+extern ENGINE_API float GFixedStepAcceleratedReportInterval;
+
 /**
  * Implements the main engine loop.	
  */
@@ -26,13 +37,142 @@ public:
     int32 PreInit(const TCHAR* CmdLine)
     {
         //...
+
+        /**
+         * kwakkh
+         * - 모듈 / 델리게이트가 EStartupPhase::PreInit 단계에 등록한 초기화 태스크를 의존성 그래프대로 실행한다. (see FStartupTaskGraph)
+         * - GStartupTaskGraphParallel이고 태스크 워커가 이미 돌고 있으면 의존성이 없는 태스크끼리 동시에 실행된다. 이 함수는 모두 끝날 때까지 기다린다.
+         * - 엔진 자체의 PreInit 단계들(위아래 생략된 부분)은 아직 그래프로 옮기지 않았다. 그래프에 등록한 태스크만 여기서 실행되고,
+         *   기존 단계들은 지금처럼 메인 스레드에서 순서대로 실행된다. (콜드 스타트 시간은 기존 단계를 옮긴 만큼만 줄어든다)
+         */
+        FStartupTaskGraph::Get(EStartupPhase::PreInit).Run(TEXT("PreInit"));
+
+        FParse::Value(CmdLine, TEXT("FixedStepAccelerated="), GFixedStepAcceleratedDeltaTime);
+
+        //...
     }
 
+    /**
+     * kwakkh : GFramePipelineDepth / GFramePipelineHeadless 변경을 반영한다. (Tick 시작 시 호출)
+     * - 깊이를 바꾸거나 소비자를 교체하기 전에는 항상 파이프라인을 비운다.
+     * - 헤드리스가 아니면 렌더 스레드가 소비자다. (Tick에서 SubmitFrame 직후 EnqueueRenderThreadFrameConsume)
+     *   - 깊이 > 0이면 어느 쪽이든 소비자가 반드시 있으므로 BeginFrame / Flush가 영원히 기다리지 않는다.
+     *   - 렌더 스레드 경로에서는 Tick 끝의 FFrameEndSync가 이미 한 프레임 앞서기까지만 허용하므로 깊이를 1로 제한한다.
+     */
+    void UpdateFramePipeline()
+    {
+        const int32 RequestedDepth = FMath::Clamp(GFramePipelineDepth, 0, FFramePipeline::MaxDepth);
+        const bool bDesiredHeadless = RequestedDepth > 0 && GFramePipelineHeadless != 0;
+        const int32 DesiredDepth = bDesiredHeadless ? RequestedDepth : FMath::Min(RequestedDepth, 1);
+        if (DesiredDepth == FramePipelineDepth && bDesiredHeadless == HeadlessFrameConsumer.IsValid())
+        {
+            return;
+        }
+
+        FramePipeline.Flush();
+        HeadlessFrameConsumer.Reset();
+
+        if (DesiredDepth != RequestedDepth)
+        {
+            UE_LOG(LogInit, Warning, TEXT("r.FramePipelineDepth=%d is limited to %d while the render thread is the consumer (FFrameEndSync allows one frame of lag). Use -HeadlessFramePipeline to measure deeper pipelines."), RequestedDepth, DesiredDepth);
+        }
+
+        FramePipelineDepth = DesiredDepth;
+        if (FramePipelineDepth > 0)
+        {
+            FramePipeline.SetDepth(FramePipelineDepth);
+            FramePipeline.ResetStats();
+            if (bDesiredHeadless)
+            {
+                HeadlessFrameConsumer = MakeUnique<FHeadlessFrameConsumer>(FramePipeline);
+            }
+        }
+    }
+
+    /** 파이프라인 모드가 켜져 있을 때, 이번 프레임 패킷 (게임 스레드에서 소비자 커맨드를 추가하는 용도). 꺼져 있으면 nullptr */
+    FFramePacket* GetCurrentFramePacket() { return CurrentFramePacket; }
+
+    const FFramePipeline& GetFramePipeline() const { return FramePipeline; }
+
+    /** 마지막 Tick에서 GEngine->Tick 자체에 걸린 시간 (cycles). Tick 전체 시간과의 차이가 메인 루프 오버헤드 */
+    uint64 GetLastEngineTickCycles() const { return LastEngineTickCycles; }
+
+    /**
+     * kwakkh : GFixedStepAcceleratedDeltaTime 변경을 반영한다. (Tick 시작 시 호출)
+     * - 켜질 때 FApp의 고정 틱 설정과 대기 생략을 적용하고, 꺼질 때 켜기 전의 설정으로 되돌린다.
+     * - EngineTickBatch 중에는 바꾸지 않고, 배치가 끝난 뒤 첫 Tick으로 미룬다.
+     *   - 배치 중에 켜면 배치가 임시로 설정한 값을 "켜기 전의 설정"으로 저장하게 되고, 배치 중에 끄면 배치의 값을 덮어쓴다.
+     *   - 미루면 두 저장/복원 쌍이 항상 중첩(모드 안에 배치)되므로 서로의 값을 덮어쓰지 않는다.
+     */
+    void UpdateFixedStepAcceleratedMode()
+    {
+        const double DesiredDeltaTime = FMath::Max(GFixedStepAcceleratedDeltaTime, 0.f);
+        if (DesiredDeltaTime == FixedStepAcceleratedDeltaTime || bTickBatchActive)
+        {
+            return;
+        }
+
+        if (FixedStepAcceleratedDeltaTime == 0.0)
+        {
+            bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+            PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+            bPrevSkipMaxTickRateWait = GEngine->bSkipMaxTickRateWait;
+        }
+
+        FixedStepAcceleratedDeltaTime = DesiredDeltaTime;
+        if (FixedStepAcceleratedDeltaTime > 0.0)
+        {
+            FApp::SetUseFixedTimeStep(true);
+            FApp::SetFixedDeltaTime(FixedStepAcceleratedDeltaTime);
+            GEngine->bSkipMaxTickRateWait = true;
+            ResetFixedStepThroughput();
+        }
+        else
+        {
+            FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+            FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+            GEngine->bSkipMaxTickRateWait = bPrevSkipMaxTickRateWait;
+        }
+    }
+
+    /**
+     * EngineTickBatch의 시작 / 끝. 배치 동안만 고정 틱 + 대기 없음으로 바꾸고, 끝나면 배치 전의 설정으로 되돌린다.
+     * kwakkh : 고정 틱 가속 모드와 같은 FApp / GEngine 설정을 건드리므로, 두 모드의 저장/복원을 모두 FEngineLoop가 맡는다.
+     */
+    void BeginTickBatch(float FixedDeltaSeconds)
+    {
+        check(!bTickBatchActive);
+        bTickBatchActive = true;
+
+        bBatchPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+        BatchPrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+        bBatchPrevSkipMaxTickRateWait = GEngine->bSkipMaxTickRateWait;
+        FApp::SetUseFixedTimeStep(true);
+        FApp::SetFixedDeltaTime(FixedDeltaSeconds);
+        GEngine->bSkipMaxTickRateWait = true;
+    }
+
+    void EndTickBatch()
+    {
+        check(bTickBatchActive);
+        GEngine->bSkipMaxTickRateWait = bBatchPrevSkipMaxTickRateWait;
+        FApp::SetFixedDeltaTime(BatchPrevFixedDeltaTime);
+        FApp::SetUseFixedTimeStep(bBatchPrevUseFixedTimeStep);
+
+        bTickBatchActive = false;
+    }
+
+    /** 고정 틱 가속 모드에서 최근 보고 구간의 처리량 (시뮬레이션 초 / 벽시계 초). 1보다 크면 실시간보다 빠르다 */
+    double GetFixedStepThroughput() const { return LastFixedStepThroughput; }
+
     /** Advances the main loop. */
      // 9 - Foundation - Entry - FEngineLoop::Tick
      // kwakkh : 엔진의 메인 루프를 담당하는 함수
 	virtual void Tick() override
     {
+        UpdateFramePipeline();
+        UpdateFixedStepAcceleratedMode();
+
         // set FApp::CurrentTime, FApp::DeltaTime and potentially wait to enforce max tick rate
 		{
             // ...
@@ -46,6 +186,8 @@ public:
              * GameThread가 먼저 끝났다고 GameThread가 먼저 실행되면 엔진 전체의 동기화가 꺠져버리기 때문에 
              * FrameNumber와 같은 변수를 컨트롤해 서로를 동기화 한다.
              */
+			// kwakkh : 고정 틱 가속 모드에서도 호출은 그대로 한다.
+			// - 대기(sleep)만 bSkipMaxTickRateWait로 건너뛰고, 시간 진행과 FrameNumber 동기화는 평소와 같이 진행된다.
 			GEngine->UpdateTimeAndHandleMaxTickRate();
 			
             // ...
@@ -57,6 +199,100 @@ public:
          * 게임의 메인 루프
          * - Lyra를 예로들면, ULyraEditorEngine -> UUnrealEdEngine -> UEditorEngine 순으로 실행
          */
+        /**
+         * kwakkh
+         * 파이프라인 모드 (GFramePipelineDepth > 0)
+         * - 게임 스레드는 이번 프레임의 패킷을 채우고 제출만 하고 바로 다음 프레임으로 넘어간다.
+         * - 소비자가 N 프레임 뒤쳐지면 BeginFrame에서 기다린다. (lockstep 대신 back pressure로 동기화)
+         */
+        if (FramePipelineDepth > 0)
+        {
+            CurrentFramePacket = &FramePipeline.BeginFrame();
+        }
+
+        const uint64 EngineTickStartCycles = FPlatformTime::Cycles64();
 		GEngine->Tick(FApp::GetDeltaTime(), bIdleMode);
+        LastEngineTickCycles = FPlatformTime::Cycles64() - EngineTickStartCycles;
+
+        if (FramePipelineDepth > 0)
+        {
+            FramePipeline.SubmitFrame(GFrameCounter, FApp::GetDeltaTime());
+            CurrentFramePacket = nullptr;
+            if (!HeadlessFrameConsumer)
+            {
+                EnqueueRenderThreadFrameConsume(FramePipeline);
+            }
+
+            const FFramePipelineStats PipelineStats = FramePipeline.GetStats();
+            CSV_CUSTOM_STAT_GLOBAL(FramePipelineLatencyMs, (float)(PipelineStats.LastLatencySeconds * 1000.0), ECsvCustomStatOp::Set);
+            CSV_CUSTOM_STAT_GLOBAL(FramePipelineInFlight, (float)(GFrameCounter - FramePipeline.GetLastConsumedFrameNumber()), ECsvCustomStatOp::Set);
+        }
+
+        if (FixedStepAcceleratedDeltaTime > 0.0)
+        {
+            UpdateFixedStepThroughput();
+        }
+    }
+
+private:
+    void ResetFixedStepThroughput()
+    {
+        FixedStepReportStartTime = FPlatformTime::Seconds();
+        FixedStepSimulatedSeconds = 0.0;
+        FixedStepNumTicks = 0;
+    }
+
+    /** 시뮬레이션된 시간을 누적하고, 보고 간격마다 처리량을 로그 / CSV로 남긴다 */
+    void UpdateFixedStepThroughput()
+    {
+        FixedStepSimulatedSeconds += FApp::GetDeltaTime();
+        ++FixedStepNumTicks;
+
+        const double Now = FPlatformTime::Seconds();
+        const double WallSeconds = Now - FixedStepReportStartTime;
+        if (WallSeconds >= FMath::Max(GFixedStepAcceleratedReportInterval, 0.1f))
+        {
+            LastFixedStepThroughput = FixedStepSimulatedSeconds / WallSeconds;
+            UE_LOG(LogInit, Display, TEXT("FixedStepAccelerated: %.2fx real time (%.1f simulated s in %.1f wall s, %d ticks, %.3f ms/tick)"),
+                LastFixedStepThroughput, FixedStepSimulatedSeconds, WallSeconds, FixedStepNumTicks, WallSeconds * 1000.0 / FixedStepNumTicks);
+            CSV_CUSTOM_STAT_GLOBAL(FixedStepThroughput, (float)LastFixedStepThroughput, ECsvCustomStatOp::Set);
+
+            FixedStepReportStartTime = Now;
+            FixedStepSimulatedSeconds = 0.0;
+            FixedStepNumTicks = 0;
+        }
     }
+
+private:
+    /** 게임 스레드 -> 소비자 프레임 패킷 링 버퍼 (see GFramePipelineDepth) */
+    FFramePipeline FramePipeline;
+
+    /** 현재 적용된 파이프라인 깊이. 0이면 기존 lockstep */
+    int32 FramePipelineDepth = 0;
+
+    FFramePacket* CurrentFramePacket = nullptr;
+
+    uint64 LastEngineTickCycles = 0;
+
+    /** 현재 적용된 고정 틱 가속 모드의 델타. 0이면 꺼짐 */
+    double FixedStepAcceleratedDeltaTime = 0.0;
+
+    /** 고정 틱 가속 모드를 켜기 전의 설정 (끌 때 복원) */
+    bool bPrevUseFixedTimeStep = false;
+    double PrevFixedDeltaTime = 0.0;
+    bool bPrevSkipMaxTickRateWait = false;
+
+    /** EngineTickBatch 진행 중 여부와 배치 전의 설정 (see BeginTickBatch) */
+    bool bTickBatchActive = false;
+    bool bBatchPrevUseFixedTimeStep = false;
+    double BatchPrevFixedDeltaTime = 0.0;
+    bool bBatchPrevSkipMaxTickRateWait = false;
+
+    double FixedStepReportStartTime = 0.0;
+    double FixedStepSimulatedSeconds = 0.0;
+    int32 FixedStepNumTicks = 0;
+    double LastFixedStepThroughput = 0.0;
+
+    /** GFramePipelineHeadless일 때 렌더 스레드를 대신하는 소비자 */
+    TUniquePtr<FHeadlessFrameConsumer> HeadlessFrameConsumer;
 }
\ No newline at end of file
@@ -6,6 +6,198 @@
 // 하지만, 레벨이 스트리밍되어 로드된 경우, 그 레벨의 소유 월드(OwningWorld)는 해당 레벨이 속한 월드를 나타낸다.
 //
 
+/** 
+ * 0이 아니면 레벨의 컴포넌트 등록 전에 액터들의 스레드 안전한 사전 등록 작업을 워커 스레드에서 병렬로 실행한다.
+ * (s.ParallelActorPreRegistration 콘솔 변수로 제어)
+ */
+extern ENGINE_API int32 GParallelActorPreRegistration;
+
+/** 병렬 사전 등록 시 워커 하나가 한 번에 가져가는 액터 수 (s.ParallelActorPreRegistrationBatchSize) */
+extern ENGINE_API int32 GParallelActorPreRegistrationBatchSize;
+
+/**
+ * 액터별 컴포넌트 등록 비용(마이크로초)을 레벨 패키지 단위로 기억해두는 전역 캐시.
+ * 같은 레벨을 다시 로드할 때, 한 프레임 예산 안에 몇 개의 액터를 등록할 수 있을지 예측하는 데 사용한다.
+ * 
+ * kwakkh
+ * - ULevel 객체는 로드할 때마다 새로 만들어지기 때문에, 비용 기록을 ULevel 안에 두면 다음 로드에서 쓸 수 없다.
+ * - 그래서 레벨 패키지 이름 -> (액터 이름 -> 비용) 형태로 레벨 바깥에 보관한다.
+ */
+struct FActorRegistrationCostHistory
+{
+    static FActorRegistrationCostHistory& Get()
+    {
+        static FActorRegistrationCostHistory Instance;
+        return Instance;
+    }
+
+    /** 기억하는 레벨 패키지 수 상한. 넘으면 가장 오래 기록되지 않은 레벨을 버린다 */
+    static constexpr int32 MaxLevels = 64;
+
+    /** 레벨 하나에서 기억하는 액터 수 상한. 넘으면 새 액터는 기록하지 않고 평균으로 예측한다 */
+    static constexpr int32 MaxActorsPerLevel = 16384;
+
+    /** 측정한 비용을 기록. 이전 기록이 있다면 지수 이동 평균으로 섞는다. */
+    void Record(FName LevelPackageName, FName ActorName, float CostMicroseconds)
+    {
+        FLevelCosts& LevelCosts = FindOrAddLevel(LevelPackageName);
+        LevelCosts.LastRecordFrame = GFrameCounter;
+        if (float* Cost = LevelCosts.ActorCosts.Find(ActorName))
+        {
+            *Cost = FMath::Lerp(*Cost, CostMicroseconds, 0.5f);
+        }
+        else if (LevelCosts.ActorCosts.Num() < MaxActorsPerLevel)
+        {
+            LevelCosts.ActorCosts.Add(ActorName, CostMicroseconds);
+        }
+
+        // 첫 샘플로 평균을 시작한다 (0에서 천천히 올라가면 처음 보는 액터의 비용을 크게 과소평가한다)
+        AverageCostMicroseconds = (NumSamples == 0) ? CostMicroseconds : FMath::Lerp(AverageCostMicroseconds, CostMicroseconds, 0.05f);
+        ++NumSamples;
+    }
+
+    /** 기록된 비용을 반환. 처음 보는 액터라면 지금까지의 평균 비용으로 예측한다. */
+    float Predict(FName LevelPackageName, FName ActorName) const
+    {
+        if (const FLevelCosts* LevelCosts = CostsPerLevel.Find(LevelPackageName))
+        {
+            if (const float* Cost = LevelCosts->ActorCosts.Find(ActorName))
+            {
+                return *Cost;
+            }
+        }
+        return AverageCostMicroseconds;
+    }
+
+private:
+    struct FLevelCosts
+    {
+        TMap<FName, float> ActorCosts;
+        uint64 LastRecordFrame = 0;
+    };
+
+    FLevelCosts& FindOrAddLevel(FName LevelPackageName)
+    {
+        if (FLevelCosts* LevelCosts = CostsPerLevel.Find(LevelPackageName))
+        {
+            return *LevelCosts;
+        }
+
+        if (CostsPerLevel.Num() >= MaxLevels)
+        {
+            // kwakkh : 레벨 로드는 드물기 때문에, 상한에 닿았을 때 선형으로 가장 오래된 레벨을 찾아도 충분하다
+            FName OldestLevel;
+            uint64 OldestFrame = MAX_uint64;
+            for (const TPair<FName, FLevelCosts>& Pair : CostsPerLevel)
+            {
+                if (Pair.Value.LastRecordFrame < OldestFrame)
+                {
+                    OldestFrame = Pair.Value.LastRecordFrame;
+                    OldestLevel = Pair.Key;
+                }
+            }
+            CostsPerLevel.Remove(OldestLevel);
+        }
+        return CostsPerLevel.Add(LevelPackageName);
+    }
+
+    TMap<FName, FLevelCosts> CostsPerLevel;
+    float AverageCostMicroseconds = 0.f;
+    uint64 NumSamples = 0;
+};
+
+/**
+ * 레벨에 등록된 컴포넌트들을 클래스별 버킷(bucket)에 빽빽하게(dense) 모아둔 레지스트리.
+ * UActorComponent의 등록/해제 시점(ExecuteRegisterEvents/ExecuteUnregisterEvents)에 갱신된다.
+ * 
+ * kwakkh
+ * - AActor::OwnedComponents는 TSet(해시 집합)이라 순회할 때 빈 슬롯을 건너뛰어야 하고, 액터마다 따로 흩어져 있다.
+ * - "레벨 L에 있는 클래스 X의 모든 컴포넌트"를 찾으려면 모든 액터 -> 모든 컴포넌트 -> IsA 검사를 해야 했다.
+ * - 레지스트리는 정확한 클래스별로 TArray를 하나씩 두고, 질의 클래스의 자식 클래스인 버킷만 골라 선형으로 훑는다.
+ * - 삭제는 컴포넌트가 자신의 버킷 내 인덱스를 기억하고 있어서 RemoveAtSwap으로 O(1)에 처리한다.
+ * 
+ *  Diagram:
+ *    Buckets
+ *    ├──UStaticMeshComponent   : [ Comp3, Comp7, Comp8, ... ]
+ *    ├──USkeletalMeshComponent : [ Comp1, Comp9, ... ]
+ *    └──UAudioComponent        : [ Comp2, ... ]
+ *
+ *    ForEachComponentOfClass(UPrimitiveComponent) -> StaticMesh 버킷 + SkeletalMesh 버킷만 순회
+ */
+struct FLevelComponentRegistry
+{
+    void Add(UActorComponent* Component)
+    {
+        check(Component->ComponentRegistryIndex == INDEX_NONE && Component->OwningComponentRegistry == nullptr);
+        TArray<UActorComponent*>& Bucket = Buckets.FindOrAdd(Component->GetClass());
+        Component->ComponentRegistryIndex = Bucket.Add(Component);
+        Component->OwningComponentRegistry = this;
+    }
+
+    /** Component가 등록된 레지스트리(Component->OwningComponentRegistry)에서 호출해야 한다 */
+    void Remove(UActorComponent* Component)
+    {
+        if (Component->ComponentRegistryIndex == INDEX_NONE)
+        {
+            return;
+        }
+        check(Component->OwningComponentRegistry == this);
+
+        TArray<UActorComponent*>& Bucket = Buckets.FindChecked(Component->GetClass());
+        const int32 Index = Component->ComponentRegistryIndex;
+        check(Bucket[Index] == Component);
+
+        Bucket.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        if (Bucket.IsValidIndex(Index))
+        {
+            // 마지막 원소가 빈 자리로 옮겨졌으므로 인덱스를 갱신
+            Bucket[Index]->ComponentRegistryIndex = Index;
+        }
+        Component->ComponentRegistryIndex = INDEX_NONE;
+        Component->OwningComponentRegistry = nullptr;
+    }
+
+    /** Class 또는 그 자식 클래스인 모든 등록된 컴포넌트에 대해 Func(UActorComponent*)를 호출. 순회 중 등록/해제는 금지 */
+    template<typename FuncType>
+    void ForEachComponentOfClass(const UClass* Class, FuncType&& Func) const
+    {
+        for (const TPair<UClass*, TArray<UActorComponent*>>& Pair : Buckets)
+        {
+            if (Pair.Key->IsChildOf(Class))
+            {
+                for (UActorComponent* Component : Pair.Value)
+                {
+                    Func(Component);
+                }
+            }
+        }
+    }
+
+    template<typename ComponentType, typename FuncType>
+    void ForEachComponentOfClass(FuncType&& Func) const
+    {
+        ForEachComponentOfClass(ComponentType::StaticClass(), [&Func](UActorComponent* Component)
+        {
+            Func(static_cast<ComponentType*>(Component));
+        });
+    }
+
+    /** 버킷들이 차지하는 메모리 (비교/통계용) */
+    SIZE_T GetAllocatedSize() const
+    {
+        SIZE_T Size = Buckets.GetAllocatedSize();
+        for (const TPair<UClass*, TArray<UActorComponent*>>& Pair : Buckets)
+        {
+            Size += Pair.Value.GetAllocatedSize();
+        }
+        return Size;
+    }
+
+private:
+    /** 정확한 클래스 -> 해당 클래스의 등록된 컴포넌트들 */
+    TMap<UClass*, TArray<UActorComponent*>> Buckets;
+};
+
 /**
  * 레벨은 액터들(조명, 볼륨, 메시 인스턴스 등)의 집합체(Collection
  * 여러 레벨이 월드 안으로 로드되거나 언로드되어 스트리밍 경험을 만들어낼 수 있다.
@@ -57,8 +249,270 @@ public:
         return bIsPersistent;
     }
 
-    bool IncrementalRegisterComponents(FRegisterComponentContext& Context)
+    /** 
+     * Actors와 같은 인덱스를 쓰는 SoA(Structure of Arrays) 사이드 테이블.
+     * 
+     * kwakkh
+     * - Actors는 포인터 배열이라, 액터의 비트 몇 개를 읽으려 해도 매번 힙에 있는 AActor까지 따라가야 한다. (캐시 미스)
+     * - 자주 읽는 비트와 RootComponent만 따로 빽빽한 배열에 복사해두면, 필터링은 이 배열만 훑고 조건을 만족하는 액터만 역참조하면 된다.
+     * 
+     *  Diagram:
+     *    Actors:          [ Actor0*, Actor1*, Actor2*, Actor3*, ... ]  ──► 힙 여기저기
+     *    Flags:           [ 0b1011 , 0b0000 , 0b1111 , 0b1000 , ... ]  ──► 연속된 메모리
+     *    RootComponents:  [ Root0* , Root1* , Root2* , Root3* , ... ]
+     */
+    struct FLevelActorHotData
+    {
+        TArray<EActorHotFlags> Flags;
+        TArray<USceneComponent*> RootComponents;
+
+        /** 
+         * 다음 질의 전에 전체를 재구성해야 하면 true.
+         * Actors를 일괄 변경하는 곳(로드, SortActorList 등)의 InvalidateActorHotData, 또는 액터의 인덱스를 찾지 못한 UpdateActorHotData가 설정한다.
+         */
+        bool bDirty = true;
+    };
+
+    /** Actors 전체를 다시 읽어 사이드 테이블을 재구성 */
+    void RebuildActorHotData()
+    {
+        ActorHotData.Flags.SetNumUninitialized(Actors.Num());
+        ActorHotData.RootComponents.SetNumUninitialized(Actors.Num());
+        ActorHotData.bDirty = false;
+        for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+        {
+            if (AActor* Actor = Actors[ActorIndex])
+            {
+                Actor->LevelHotDataIndex = ActorIndex;
+            }
+            UpdateActorHotData(ActorIndex);
+        }
+    }
+
+    /** 
+     * 사이드 테이블이 무효화되었으면 재구성한다. (질의 전에 호출)
+     * kwakkh
+     * - Actors를 바꾸는 곳이 직접 알려준다. (OnActorAdded / OnActorRemoved / InvalidateActorHotData)
+     * - 크기 비교는 알려주지 않고 Actors에 추가/삭제한 코드에 대한 안전망이다. (O(1)) 재정렬은 잡지 못하므로 재정렬하는 곳은 반드시 무효화해야 한다.
+     */
+    void FlushActorHotData()
+    {
+        if (ActorHotData.bDirty || ActorHotData.Flags.Num() != Actors.Num())
+        {
+            RebuildActorHotData();
+        }
+    }
+
+    /** Actors를 일괄 변경(로드, 재정렬, 여러 개 추가/삭제)한 뒤 호출. 다음 질의 때 전체를 재구성한다 */
+    void InvalidateActorHotData()
+    {
+        ActorHotData.bDirty = true;
+    }
+
+    /** Actors 끝에 액터를 추가한 직후 호출 (UWorld::SpawnActor). 테이블이 최신이면 항목 하나만 덧붙인다 */
+    void OnActorAdded(AActor* Actor)
     {
+        const int32 ActorIndex = Actors.Num() - 1;
+        if (ActorHotData.bDirty || ActorHotData.Flags.Num() != ActorIndex || Actors[ActorIndex] != Actor)
+        {
+            ActorHotData.bDirty = true;
+            return;
+        }
+
+        ActorHotData.Flags.AddUninitialized();
+        ActorHotData.RootComponents.AddUninitialized();
+        Actor->LevelHotDataIndex = ActorIndex;
+        UpdateActorHotData(ActorIndex);
+    }
+
+    /** Actors[ActorIndex]를 nullptr로 비운 직후 호출 (UWorld::RemoveActor). 빈 슬롯은 어떤 플래그도 갖지 않는다 */
+    void OnActorRemoved(int32 ActorIndex)
+    {
+        UpdateActorHotData(ActorIndex);
+    }
+
+    /** 
+     * 한 액터의 상태가 바뀐 뒤(초기화, 틱 등록, BeginPlay/EndPlay, 컴포넌트 등록 해제, 루트 컴포넌트 변경 등) 호출. (see AActor::UpdateLevelHotData)
+     * 액터가 기억하는 인덱스가 더 이상 맞지 않으면 다음 질의 때 전체를 재구성하도록 표시만 한다.
+     */
+    void UpdateActorHotData(AActor* Actor)
+    {
+        const int32 ActorIndex = Actor->LevelHotDataIndex;
+        if (ActorHotData.Flags.IsValidIndex(ActorIndex) && Actors.IsValidIndex(ActorIndex) && Actors[ActorIndex] == Actor)
+        {
+            UpdateActorHotData(ActorIndex);
+        }
+        else
+        {
+            ActorHotData.bDirty = true;
+        }
+    }
+
+    /** 한 액터의 상태가 바뀐 뒤(초기화, 틱 등록, BeginPlay, 컴포넌트 등록 완료 등) 해당 인덱스만 갱신 */
+    void UpdateActorHotData(int32 ActorIndex)
+    {
+        if (!ActorHotData.Flags.IsValidIndex(ActorIndex) || !Actors.IsValidIndex(ActorIndex))
+        {
+            ActorHotData.bDirty = true;
+            return;
+        }
+
+        AActor* Actor = Actors[ActorIndex];
+        const bool bValid = IsValid(Actor);
+        ActorHotData.Flags[ActorIndex] = bValid ? Actor->GetHotFlags() : EActorHotFlags::None;
+        ActorHotData.RootComponents[ActorIndex] = bValid ? Actor->GetRootComponent() : nullptr;
+    }
+
+    /** 
+     * RequiredFlags를 모두 가지고 ExcludedFlags를 하나도 가지지 않은 액터들에 대해 Func(AActor*, USceneComponent* Root)를 호출.
+     * 비트 검사는 사이드 테이블에서만 이뤄지므로, 조건에 맞지 않는 액터는 역참조하지 않는다.
+     * Func 안에서 Actors를 바꾸면 안 된다.
+     */
+    template<typename FuncType>
+    void ForEachActorWithHotFlags(EActorHotFlags RequiredFlags, EActorHotFlags ExcludedFlags, FuncType&& Func)
+    {
+        FlushActorHotData();
+
+        const EActorHotFlags* FlagsData = ActorHotData.Flags.GetData();
+        const int32 NumActors = FMath::Min(ActorHotData.Flags.Num(), Actors.Num());
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            const EActorHotFlags Flags = FlagsData[ActorIndex];
+            if (EnumHasAllFlags(Flags, RequiredFlags) && !EnumHasAnyFlags(Flags, ExcludedFlags))
+            {
+                Func(Actors[ActorIndex].Get(), ActorHotData.RootComponents[ActorIndex]);
+            }
+        }
+    }
+
+    /** 액터를 배치 틱 함수에 추가. 배치가 처음 만들어지면 키(= 액터의 틱 설정)로 TickTaskLevel에 등록한다 */
+    void AddActorToTickBatch(AActor* Actor)
+    {
+        check(!Actor->TickBatch);
+        const FActorTickFunction& ActorTick = Actor->PrimaryActorTick;
+        const FActorTickBatchKey Key{ Actor->GetClass(), ActorTick.TickGroup, ActorTick.EndTickGroup, ActorTick.TickInterval, (bool)ActorTick.bTickEvenWhenPaused };
+
+        TUniquePtr<FActorBatchTickFunction>& Batch = ActorTickBatches.FindOrAdd(Key);
+        if (!Batch)
+        {
+            Batch = MakeUnique<FActorBatchTickFunction>();
+            Batch->Key = Key;
+            Batch->TickGroup = Key.TickGroup;
+            Batch->EndTickGroup = Key.EndTickGroup;
+            Batch->TickInterval = Key.TickInterval;
+            Batch->bTickEvenWhenPaused = Key.bTickEvenWhenPaused;
+            Batch->bRunOnAnyThread = false;
+            Batch->RegisterTickFunction(this);
+        }
+        Batch->AddActor(Actor);
+        Actor->TickBatch = Batch.Get();
+    }
+
+    /**
+     * 액터를 배치 틱 함수에서 제거. 배치가 비면 등록 해제하고 파괴한다
+     * kwakkh : 키를 액터의 현재 틱 설정으로 다시 만들지 않고, 배치에 저장된 등록 당시의 키를 쓴다 (그 사이 TickGroup 등이 바뀌어도 찾을 수 있다)
+     */
+    void RemoveActorFromTickBatch(AActor* Actor)
+    {
+        FActorBatchTickFunction* Batch = Actor->TickBatch;
+        check(Batch && ActorTickBatches.FindChecked(Batch->Key).Get() == Batch);
+        Actor->TickBatch = nullptr;
+
+        Batch->RemoveActor(Actor);
+        if (Batch->Actors.Num() == 0)
+        {
+            Batch->UnRegisterTickFunction();
+            ActorTickBatches.Remove(Batch->Key);
+        }
+    }
+
+    /**
+     * 병렬 사전 등록 단계. (EIncrementalComponentState::ConcurrentPreRegisterComponents)
+     * CanPreRegisterComponentsConcurrently()가 true인 액터들의 PreRegisterAllComponents_Concurrent를 워커 스레드에 나눠서 실행한다.
+     * 게임 스레드 전용 부분(PreRegisterAllComponents)은 이후 PreRegisterInitialComponents 단계에서 기존처럼 직렬로 처리된다.
+     * 
+     * kwakkh
+     * - 액터끼리는 서로 독립적이므로, 각 액터 자신의 데이터만 건드리는 작업은 나눠서 돌려도 안전하다.
+     * - 후보를 고르는 작업은 UObject 상태를 읽으므로 게임 스레드에서 하고, 실제 작업만 ParallelFor로 넘긴다.
+     * - AActor의 기본 구현은 참여하지 않는다(false). 워커 스레드에서 할 수 있는 사전 등록 작업을 가진 액터 클래스가
+     *   CanPreRegisterComponentsConcurrently와 PreRegisterAllComponents_Concurrent를 함께 오버라이드해서 참여한다.
+     * - 주의: 아직 참여하는 액터 클래스가 없다. (확장 지점만 있는 상태) 지금은 후보 수집만 하고 ParallelFor는 빈 범위로 끝난다.
+     *   첫 참여 클래스를 추가할 때 GParallelActorPreRegistration을 켜고 직렬 경로와 결과를 비교해 검증해야 한다.
+     */
+    void ConcurrentPreRegisterComponents()
+    {
+        if (GParallelActorPreRegistration == 0)
+        {
+            return;
+        }
+
+        TArray<AActor*> ConcurrentActors;
+        ConcurrentActors.Reserve(Actors.Num());
+        for (AActor* Actor : Actors)
+        {
+            if (IsValid(Actor) && !Actor->HasActorRegisteredAllComponents() && !FActorPreRegistrationAccessor::HasPreRegisteredAllComponents(Actor)
+                && Actor->CanPreRegisterComponentsConcurrently())
+            {
+                ConcurrentActors.Add(Actor);
+            }
+        }
+
+        ParallelFor(TEXT("ULevel::ConcurrentPreRegisterComponents"), ConcurrentActors.Num(), GParallelActorPreRegistrationBatchSize, [&ConcurrentActors](int32 Index)
+        {
+            ConcurrentActors[Index]->PreRegisterAllComponents_Concurrent();
+        });
+    }
+
+    /**
+     * 레벨의 컴포넌트들을 단계별로 점진적으로 갱신한다. (UWorld::UpdateLevelComponents, 레벨 스트리밍의 AddToWorld에서 호출)
+     * @return 모든 단계가 끝났으면 true
+     * 
+     * kwakkh : 단계 순서
+     * - Init -> ConcurrentPreRegisterComponents (GParallelActorPreRegistration일 때만) -> PreRegisterInitialComponents -> RegisterInitialComponents -> ... -> Finalize
+     */
+    bool IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bRerunConstructionScripts, FRegisterComponentContext* Context = nullptr)
+    {
+        //...
+
+        if (IncrementalComponentState == EIncrementalComponentState::Init)
+        {
+            SetCurrentActorIndexForIncrementalUpdate(0);
+            UpdateModelComponents();
+            IncrementalComponentState = GParallelActorPreRegistration != 0
+                ? EIncrementalComponentState::ConcurrentPreRegisterComponents
+                : EIncrementalComponentState::PreRegisterInitialComponents;
+        }
+
+        switch (IncrementalComponentState)
+        {
+        case EIncrementalComponentState::ConcurrentPreRegisterComponents:
+            // 한 번에 끝나는 단계 (ParallelFor는 모든 워커가 끝날 때까지 기다린다)
+            ConcurrentPreRegisterComponents();
+            IncrementalComponentState = EIncrementalComponentState::PreRegisterInitialComponents;
+            break;
+
+        //...
+        }
+
+        //...
+    }
+
+    /**
+     * 액터들의 컴포넌트를 점진적으로 등록한다.
+     * @param NumComponentsToUpdate     한 번에 등록할 컴포넌트 수 (0이면 전부)
+     * @param TimeBudgetMicroseconds    0보다 크면 벽시계(wall-clock) 예산 모드. 예산을 다 쓰면(또는 다음 액터가 예산을 넘길 것으로 예측되면) 반환한다.
+     * @return 모든 액터의 등록이 끝났으면 true
+     */
+    bool IncrementalRegisterComponents(int32 NumComponentsToUpdate, FRegisterComponentContext& Context, double TimeBudgetMicroseconds = 0.0)
+    {
+        // kwakkh : 컴포넌트 개수만으로 작업량을 제한하면, 액터마다 컴포넌트 비용이 크게 달라 프레임 시간이 들쭉날쭉해진다.
+        // - 시간 예산 모드에서는 실제 걸린 시간으로 멈출 지점을 정하고, 액터별 비용을 기록해 다음 로드의 예측에 사용한다.
+        // - 예산 모드가 꺼져 있으면(기본) 시간 측정과 기록을 전혀 하지 않는다.
+        const bool bUseTimeBudget = TimeBudgetMicroseconds > 0.0;
+        const double StartTime = bUseTimeBudget ? FPlatformTime::Seconds() : 0.0;
+        const FName LevelPackageName = bUseTimeBudget ? GetPackage()->GetFName() : NAME_None;
+        FActorRegistrationCostHistory& CostHistory = FActorRegistrationCostHistory::Get();
+
         // Find next valid actor to process components registration
         while (CurrentActorIndexForIncrementalUpdate < Actors.Num())
         {
@@ -71,11 +525,23 @@ public:
 #if PERF_TRACK_DETAILED_ASYNC_STATS
                     FScopeCycleCounterUObject ContextScope(Actor);
 #endif
+                    const double ActorStartTime = bUseTimeBudget ? FPlatformTime::Seconds() : 0.0;
+
                     if (!FActorPreRegistrationAccessor::HasPreRegisteredAllComponents(Actor))
                     {
                         Actor->PreRegisterAllComponents();
                     }
                     bAllComponentsRegistered = Actor->IncrementalRegisterComponents(NumComponentsToUpdate, &Context);
+
+                    // 한 액터의 등록이 여러 번의 호출로 나뉠 수 있으므로, 끝날 때까지 누적한 뒤 기록한다.
+                    if (bUseTimeBudget)
+                    {
+                        CurrentActorRegistrationCostMicroseconds += (FPlatformTime::Seconds() - ActorStartTime) * 1000000.0;
+                        if (bAllComponentsRegistered)
+                        {
+                            CostHistory.Record(LevelPackageName, Actor->GetFName(), (float)CurrentActorRegistrationCostMicroseconds);
+                        }
+                    }
                 }
 #if !UE_BUILD_SHIPPING
                 else if (GOptimizeActorRegistration == 2)
@@ -91,13 +557,33 @@ public:
 
             if (bAllComponentsRegistered)
             {
+                UpdateActorHotData(CurrentActorIndexForIncrementalUpdate);
+
                 // All components have been registered for this actor, move to a next one
-                CurrentActorIndexForIncrementalUpdate++;
+                SetCurrentActorIndexForIncrementalUpdate(CurrentActorIndexForIncrementalUpdate + 1);
             }
 
+            if (bUseTimeBudget)
+            {
+                // 예산을 다 썼거나, 다음 액터의 예측 비용이 남은 예산을 넘으면 이번 프레임은 여기까지
+                const double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+                if (ElapsedMicroseconds >= TimeBudgetMicroseconds)
+                {
+                    break;
+                }
+
+                if (CurrentActorIndexForIncrementalUpdate < Actors.Num())
+                {
+                    AActor* NextActor = Actors[CurrentActorIndexForIncrementalUpdate];
+                    if (IsValid(NextActor) && ElapsedMicroseconds + CostHistory.Predict(LevelPackageName, NextActor->GetFName()) > TimeBudgetMicroseconds)
+                    {
+                        break;
+                    }
+                }
+            }
             // If we do an incremental registration return to outer loop after each processed actor 
             // so outer loop can decide whether we want to continue processing this frame
-            if (NumComponentsToUpdate != 0)
+            else if (NumComponentsToUpdate != 0)
             {
                 break;
             }
@@ -107,7 +593,7 @@ public:
         {
             if (Context.OnIncrementalRegisterComponentsDone())
             {
-                CurrentActorIndexForIncrementalUpdate = 0;
+                SetCurrentActorIndexForIncrementalUpdate(0);
                 return true;
             }
         }
@@ -115,6 +601,25 @@ public:
         return false;
     }
 
+    /** 
+     * 점진적 등록이 가리키는 액터를 바꾼다.
+     * kwakkh : 누적 중이던 등록 비용은 이전 액터의 것이므로 함께 버린다. (끝나지 않은 액터를 건너뛰거나 처음부터 다시 시작할 때 다음 액터에 섞이지 않도록)
+     */
+    void SetCurrentActorIndexForIncrementalUpdate(int32 NewIndex)
+    {
+        CurrentActorIndexForIncrementalUpdate = NewIndex;
+        CurrentActorRegistrationCostMicroseconds = 0.0;
+    }
+
+    /** Sorts the actor list by net relevancy and static behaviour. */
+	ENGINE_API void SortActorList()
+    {
+        //...
+
+        // kwakkh : Actors의 순서가 바뀌므로 사이드 테이블의 인덱스가 모두 틀려진다
+        InvalidateActorHotData();
+    }
+
     // 11 - Foundation - CreateWorld - ULevel's member variables
 
     /** 
@@ -124,6 +629,12 @@ public:
      */
 	TArray<TObjectPtr<AActor>> Actors;
 
+    /** Actors와 같은 인덱스로 유지되는 자주 읽히는 상태의 사이드 테이블 (see FLevelActorHotData) */
+	FLevelActorHotData ActorHotData;
+
+    /** 이 레벨에 등록된 컴포넌트들을 클래스별로 모아둔 레지스트리 (see FLevelComponentRegistry) */
+	FLevelComponentRegistry ComponentRegistry;
+
     /** 이 레벨이 포함된 레벨 컬렉션을 캐시(Cached)한 것입니다. 이는 월드 내의 모든 컬렉션들을 순회(Looping)하는 것보다 더 빠른 접근을 위함이다. */
      // see FLevelCollection (goto 19)
 	FLevelCollection* CachedLevelCollection;
@@ -156,6 +667,7 @@ public:
     enum class EIncrementalComponentState : uint8
 	{
 		Init,
+		ConcurrentPreRegisterComponents,
 		PreRegisterInitialComponents,
 		RegisterInitialComponents,
 #if WITH_EDITOR
@@ -179,11 +691,18 @@ public:
     */
 	int32 CurrentActorIndexForIncrementalUpdate;
 
+    /** CurrentActorIndexForIncrementalUpdate가 가리키는 액터의 등록에 지금까지 쓴 시간(마이크로초). 여러 프레임에 걸쳐 누적되고, 인덱스가 바뀌면 0이 된다 (see SetCurrentActorIndexForIncrementalUpdate) */
+	double CurrentActorRegistrationCostMicroseconds = 0.0;
+
     /** 틱 함수들을 저장하기 위한 데이터 구조체 
      * kwakkh
      * - 액터가 틱을 도는데 있어서 종속적인 관계는 틱이 여기 포함되어서다
+     * - GTickWorkStealingExecutor가 켜져 있으면, 여기 모인 틱 함수들은 FTickWorkStealingExecutor로 실행된다. (see TickTaskManager.h)
     */
 	class FTickTaskLevel* TickTaskLevel;
 
+    /** bBatchPrimaryActorTick 액터들을 (클래스, 틱 그룹)별로 묶어 틱하는 배치 틱 함수들 */
+	TMap<FActorTickBatchKey, TUniquePtr<FActorBatchTickFunction>> ActorTickBatches;
+
     // goto 9 (UWorld's member variables)
 };
\ No newline at end of file
@@ -11,6 +11,8 @@ enum EObjectFlags
     //...
 
     RF_Transactional			=0x00000008,	///< Object is transactional.
+    RF_ClassDefaultObject		=0x00000010,	///< This object is used as the default template for all instances of a class. One object is created for each class
+    RF_ArchetypeObject			=0x00000020,	///< This object can be used as a template for instancing objects. This is set on all types of object templates
 
     //...
 };
@@ -24,6 +26,13 @@ enum EObjectFlags
  * - 주된 목적: 사용자가 Ctrl+Z (실행 취소)를 눌렀을 때, 이전 상태로 정확하게 되돌아가도록 보장하는 것.
  */
 
+/** 
+ * Outer 체인이 변경될 때마다 증가하는 전역 카운터.
+ * 0은 "아직 캐시되지 않음"을 의미하도록 1부터 시작한다.
+ * kwakkh : Rename은 어느 스레드에서든 일어날 수 있으므로 atomic. 64비트라서 0으로 되돌아가는(wraparound) 일은 없다.
+ */
+extern COREUOBJECT_API std::atomic<uint64> GOuterChainSerialNumber;
+
 /** 
  * Low level implementation of UObject, should not be used directly in game code 
  */
@@ -32,12 +41,26 @@ enum EObjectFlags
 // UObject의 가장 기본이 되는 부모 클래스
 class UObjectBase
 {
+    /** 생성자 (발췌). bIsInsideTemplate은 Outer가 정해진 직후 계산된다 */
+	COREUOBJECT_API UObjectBase(UClass* InClass, EObjectFlags InFlags, EInternalObjectFlags InInternalFlags, UObject *InOuter, FName InName)
+        : ObjectFlags(InFlags)
+        , ClassPrivate(InClass)
+        , OuterPrivate(InOuter)
+        , bIsInsideTemplate(0)
+    {
+        //...
+        UpdateInsideTemplateBit();
+    }
+
     /** Flags used to track and report various object states. This needs to be 8 byte aligned on 32-bit
 	    platforms to reduce memory waste */
     // kwakkh : UObject의 동작이나 속성을 메타데이터 형식으로 정의하기 위한 **비트 플래그(bit flags)**
     // - UObject의 속성값들에 필요한 것들을 마킹해 놓은게 다 들어가 있다고 보면 된다.
 	EObjectFlags ObjectFlags;
 
+    /** 이 객체의 타입(Class) */
+	ObjectPtr_Private::TNonAccessTrackedObjectPtr<UClass> ClassPrivate;
+
 
     /** 이 객체가 위치하고 있는 상위 객체 */
     /**
@@ -50,8 +73,88 @@ class UObjectBase
      * - 지금은, OuterPrivate가 일반적으로 UPackage로 설정된다는 것만 이해하시면 충분!"
      */
 	ObjectPtr_Private::TNonAccessTrackedObjectPtr<UObject> OuterPrivate;
+
+    /** 
+     * OuterPrivate를 변경하는 유일한 통로. (LowLevelRename, Rename 등에서 호출)
+     * Outer 체인이 바뀌면 GetTypedOuter 결과를 캐시한 곳들이 모두 무효화되도록 GOuterChainSerialNumber를 증가시킨다.
+     */
+	COREUOBJECT_API void SetOuter_Private(UObject* NewOuter)
+    {
+        OuterPrivate = NewOuter;
+        UpdateInsideTemplateBit();
+
+        // kwakkh : 이 객체 아래의 하위 객체들도 Outer 체인이 바뀐 것이므로 비트를 다시 계산해야 한다
+        PropagateInsideTemplateBitToInners();
+
+        // kwakkh : 어떤 객체의 Outer가 바뀌면, 그 객체를 Outer 체인에 포함하는 모든 하위 객체들의 캐시도 틀어진다.
+        // - 하위 객체들을 일일이 찾아가 무효화하는 대신, 전역 카운터 하나로 한꺼번에 무효화한다. (Rename/이동은 드물기 때문에 이 편이 싸다)
+        GOuterChainSerialNumber.fetch_add(1);
+    }
+
+    /** 
+     * Outer 체인 중에 템플릿(CDO 또는 Archetype)이 있으면 true.
+     * 객체가 생성될 때(UObjectBase 생성자), 자신 또는 Outer 체인의 객체가 SetOuter_Private / SetFlagsTo로 바뀔 때 갱신된다.
+     * 
+     * kwakkh : EObjectFlags에 넣고 싶지만, EObjectFlags의 32비트는 이미 모두 사용 중이다.
+     * - 그래서 UObjectBase 안에 별도의 비트로 둔다. (ObjectFlags 뒤의 패딩 자리를 사용하므로 객체 크기는 늘지 않는다)
+     */
+	uint8 bIsInsideTemplate : 1;
+
+    /** Outer의 상태를 보고 bIsInsideTemplate을 다시 계산 */
+	void UpdateInsideTemplateBit()
+    {
+        const UObjectBase* Outer = OuterPrivate;
+        bIsInsideTemplate = Outer && ((Outer->ObjectFlags & (RF_ArchetypeObject | RF_ClassDefaultObject)) || Outer->bIsInsideTemplate);
+    }
+
+    /** Outer 체인을 직접 순회해 bIsInsideTemplate을 계산 (Outer의 비트가 아직 갱신되지 않았을 수도 있을 때 사용) */
+	void UpdateInsideTemplateBitFromOuterChain()
+    {
+        bool bInsideTemplate = false;
+        for (const UObjectBase* Outer = OuterPrivate; Outer && !bInsideTemplate; Outer = Outer->OuterPrivate)
+        {
+            bInsideTemplate = (Outer->ObjectFlags & (RF_ArchetypeObject | RF_ClassDefaultObject)) != 0;
+        }
+        bIsInsideTemplate = bInsideTemplate;
+    }
+
+    /**
+     * 이 객체를 Outer 체인에 포함하는 모든 하위 객체(중첩 포함)의 bIsInsideTemplate을 다시 계산한다.
+     * kwakkh
+     * - Outer 변경(Rename/이동)과 템플릿 플래그 변경은 드물기 때문에, 그때만 하위 객체 전체를 한 번 훑는다.
+     * - ForEachObjectWithOuter의 순회 순서는 부모 -> 자식 순이 보장되지 않으므로, 각 객체가 Outer 체인을 직접 순회해 계산한다.
+     */
+	void PropagateInsideTemplateBitToInners()
+    {
+        ForEachObjectWithOuter(this, [](UObject* Inner)
+        {
+            Inner->UpdateInsideTemplateBitFromOuterChain();
+        }, /*bIncludeNestedObjects*/ true);
+    }
+
+    /**
+     * ObjectFlags를 바꾸는 저수준 통로. (SetFlags / ClearFlags가 이 함수를 거친다)
+     * 템플릿 플래그(RF_ArchetypeObject / RF_ClassDefaultObject)가 바뀌면 하위 객체들의 bIsInsideTemplate도 갱신한다.
+     */
+	FORCEINLINE void SetFlagsTo(EObjectFlags NewFlags)
+    {
+        const bool bTemplateFlagsChanged = ((ObjectFlags ^ NewFlags) & (RF_ArchetypeObject | RF_ClassDefaultObject)) != 0;
+        ObjectFlags = NewFlags;
+        if (bTemplateFlagsChanged)
+        {
+            PropagateInsideTemplateBitToInners();
+        }
+    }
 };
 
+#if !UE_BUILD_SHIPPING
+/** 
+ * 0이 아니면 IsTemplate()이 캐시된 bIsInsideTemplate 비트와 Outer 체인을 직접 순회한 결과를 비교해 검증한다.
+ * (Object.ValidateInsideTemplateBit 콘솔 변수로 제어)
+ */
+extern COREUOBJECT_API int32 GValidateInsideTemplateBit;
+#endif
+
 /**
  * Provides utility functions for UObject, this class should not be used directly
  */
@@ -59,6 +162,18 @@ class UObjectBase
 // UObjectBaseUtility.h
 class UObjectBaseUtility : public UObjectBase
 {
+    /** 이 객체가 SomeBase 클래스(또는 그 자식 클래스)의 인스턴스라면 true를 반환 */
+    /**
+     * kwakkh : GetTypedOuter, IsTemplate 등 Outer 체인을 순회하는 곳에서 한 단계마다 호출된다.
+     * - 예전처럼 SuperStruct 체인을 따라 올라가면 Outer 깊이 x 클래스 깊이 만큼의 포인터 추적이 필요하다.
+     * - FStructBaseChain(아래 참고)을 사용하면 한 번의 범위 검사와 비교로 끝난다.
+     */
+	FORCEINLINE bool IsA(const UClass* SomeBase) const
+    {
+        const UClass* ThisClass = ClassPrivate;
+        return ThisClass->IsChildOfUsingStructArray(*(const FStructBaseChain*)SomeBase);
+    }
+
     /**
 	 * Traverses the outer chain searching for the next object of a certain type.  (T must be derived from UObject)
 	 *
@@ -97,6 +212,26 @@ class UObjectBaseUtility : public UObjectBase
 	 */
     // 54 - Foundation - CreateWorld - UObjectBaseUtility::IsTemplate()
 	COREUOBJECT_API bool IsTemplate(EObjectFlags TemplateTypes = RF_ArchetypeObject|RF_ClassDefaultObject) const;
+    {
+        // kwakkh : 기본 인자로 불리는 경우(대부분, e.g. AActor::RegisterActorTickFunctions의 check(!IsTemplate()))는
+        // Outer 체인을 다시 순회할 필요 없이 자신의 플래그와 상속받은 bIsInsideTemplate 비트만 보면 된다.
+        if (TemplateTypes == (RF_ArchetypeObject|RF_ClassDefaultObject))
+        {
+            const bool bIsTemplate = HasAnyFlags(TemplateTypes) || bIsInsideTemplate;
+#if !UE_BUILD_SHIPPING
+            if (GValidateInsideTemplateBit)
+            {
+                ensureMsgf(bIsTemplate == IsTemplate_Slow(TemplateTypes), TEXT("Cached inside-template bit is stale for %s"), *GetFullName());
+            }
+#endif
+            return bIsTemplate;
+        }
+
+        return IsTemplate_Slow(TemplateTypes);
+    }
+
+    /** Outer 체인을 직접 순회하며 템플릿 여부를 판단한다. (다른 플래그 조합으로 검사하거나 캐시 비트를 검증할 때 사용) */
+	bool IsTemplate_Slow(EObjectFlags TemplateTypes) const
     {
         for (const UObjectBaseUtility* TestOuter = this; TestOuter; TestOuter = TestOuter->GetOuter() )
         {
@@ -118,4 +253,72 @@ class UObjectBaseUtility : public UObjectBase
 class UObject : public UObjectBaseUtility
 {
 
-};
\ No newline at end of file
+};
+
+/**
+ * 클래스 계층 구조를 평평한(flat) 배열로 들고 있는 구조체.
+ * 클래스가 등록(Link)될 때 한 번 만들어지며, 이후 IsChildOf는 배열 조회 한 번으로 끝난다.
+ * 
+ * kwakkh : Class.h 에 존재 (UStruct가 이 구조체를 상속)
+ * - 깊이(depth)가 N인 클래스는 [UObject, ..., 부모, 자기 자신] 순서의 N+1 크기 조상 배열을 가진다.
+ * - A가 B의 자식인지 확인하려면 "A의 조상 배열에서 B의 깊이 위치에 B가 있는가?"만 보면 된다.
+ * 
+ *  Diagram:
+ *    UObject(depth 0) ─► AActor(depth 1) ─► APawn(depth 2) ─► ACharacter(depth 3)
+ *
+ *    ACharacter::StructBaseChainArray = [UObject, AActor, APawn, ACharacter]
+ *    ACharacter->IsChildOf(APawn) == (2 <= 3 && StructBaseChainArray[2] == APawn)
+ */
+class FStructBaseChain
+{
+protected:
+	COREUOBJECT_API FStructBaseChain() = default;
+	COREUOBJECT_API ~FStructBaseChain()
+    {
+        delete [] StructBaseChainArray;
+    }
+
+    // Non-copyable
+	FStructBaseChain(const FStructBaseChain&) = delete;
+	FStructBaseChain& operator=(const FStructBaseChain&) = delete;
+
+    /** 클래스 등록 시점(UStruct::Link)에 호출되어 조상 배열을 다시 만든다. 부모 클래스의 배열이 먼저 만들어져 있어야 한다. */
+	COREUOBJECT_API void ReinitializeBaseChainArray()
+    {
+        delete [] StructBaseChainArray;
+
+        int32 Depth = 0;
+        for (UStruct* Ptr = static_cast<UStruct*>(this); Ptr; Ptr = Ptr->GetSuperStruct())
+        {
+            ++Depth;
+        }
+
+        FStructBaseChain** Bases = new FStructBaseChain*[Depth];
+        {
+            FStructBaseChain** Base = Bases + Depth;
+            for (UStruct* Ptr = static_cast<UStruct*>(this); Ptr; Ptr = Ptr->GetSuperStruct())
+            {
+                *--Base = Ptr;
+            }
+        }
+
+        StructBaseChainArray = Bases;
+        NumStructBasesInChainMinusOne = Depth - 1;
+    }
+
+	FORCEINLINE bool IsChildOfUsingStructArray(const FStructBaseChain& Parent) const
+    {
+        int32 NumParentStructBasesInChainMinusOne = Parent.NumStructBasesInChainMinusOne;
+        return NumParentStructBasesInChainMinusOne <= NumStructBasesInChainMinusOne && StructBaseChainArray[NumParentStructBasesInChainMinusOne] == &Parent;
+    }
+
+private:
+    /** 루트(UObject)부터 자기 자신까지의 조상 배열 */
+	FStructBaseChain** StructBaseChainArray = nullptr;
+
+    /** 계층 구조에서의 깊이 (UObject == 0) */
+	int32 NumStructBasesInChainMinusOne = -1;
+
+	friend class UStruct;
+	friend class UObjectBaseUtility;
+};
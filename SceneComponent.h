@@ -1,9 +1,18 @@
+/**
+ * 0이 아니면 등록되는 SceneComponent를 월드의 FSceneTransformHierarchy에 넣고,
+ * UpdateComponentToWorld가 재귀(UpdateChildTransforms) 대신 계층에 dirty로 표시만 해둔다.
+ * 표시된 서브트리들은 FSceneTransformHierarchy::Flush의 선형 패스 한 번으로 모아서 갱신된다.
+ * (r.FlatTransformHierarchy 콘솔 변수로 제어. 이미 등록된 컴포넌트에는 재등록 시점부터 적용된다)
+ */
+extern ENGINE_API int32 GFlatTransformHierarchy;
+
+struct FSceneTransformHierarchy;
 
 /**
  * SceneComponent는 Transform을 가지고 있으며 부착(Attachment)을 지원하지만, 렌더링이나 충돌 기능은 가지고 있지 않다.
  * 이 컴포넌트는 계층 구조 내에서 다른 컴포넌트들의 위치를 오프셋(offset, 간격/기준점)시키기 위한 '더미' 컴포넌트로 유용하다.
  * @see [Scene Components](https://docs.unrealengine.com/latest/INT/Programming/UnrealArchitecture/Actors/Components/index.html#scenecomponents)
- * 
+ *
  * 17 - Foundation - CreateWorld - USceneComponent
  * kwakkh
  * USceneComponent는 씬 그래프(scene-graph)를 지원함
@@ -22,6 +31,144 @@ class USceneComponent : public UActorComponent
         return AttachParent;
     }
 
+    /**
+     * Get the current component-to-world transform for this component
+     * kwakkh : 계층에 미뤄둔 갱신이 남아 있으면 읽기 전에 반영한다. 호출자는 기존과 같이 항상 최신 값을 본다
+     */
+	FORCEINLINE const FTransform& GetComponentTransform() const
+    {
+        if (OwningTransformHierarchy && OwningTransformHierarchy->HasPendingUpdates())
+        {
+            OwningTransformHierarchy->Flush();
+        }
+        return ComponentToWorld;
+    }
+
+	ENGINE_API virtual void OnRegister() override
+    {
+        //...
+        // kwakkh : 부모보다 먼저 등록되어도 괜찮다. 계층 재구성(Rebuild) 때 부착 트리를 보고 순서를 정한다
+        if (GFlatTransformHierarchy)
+        {
+            if (UWorld* World = GetWorld())
+            {
+                World->TransformHierarchy.Add(this);
+            }
+        }
+        //...
+    }
+
+	ENGINE_API virtual void OnUnregister() override
+    {
+        // kwakkh : 등록 해제 시점의 GetWorld()는 nullptr이거나 (레벨 이동 등으로) 다른 월드일 수 있으므로, Add한 계층에서 뺀다
+        if (OwningTransformHierarchy)
+        {
+            OwningTransformHierarchy->Remove(this);
+        }
+        //...
+    }
+
+    /**
+     * Recalculate the value of our component to world transform
+     * kwakkh : 계층에 들어 있으면 자신을 dirty 서브트리 루트로 표시만 한다. 실제 계산은 FSceneTransformHierarchy::Flush에서 모아서 한다
+     */
+	ENGINE_API virtual void UpdateComponentToWorld(EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None) override
+    {
+        if (OwningTransformHierarchy)
+        {
+            OwningTransformHierarchy->MarkDirty(this, UpdateTransformFlags, Teleport);
+            return;
+        }
+        UpdateComponentToWorldWithParent(GetAttachParent(), GetAttachSocketName(), UpdateTransformFlags, RelativeRotationCache.RotatorToQuat(GetRelativeRotation()), Teleport);
+    }
+
+    /**
+     * FSceneTransformHierarchy::Flush가 계산한 월드 트랜스폼을 반영한다.
+     * kwakkh : UpdateComponentToWorldWithParent의 반영 부분과 같다. 자식 재귀(UpdateChildTransforms)만 빠지고, 자식은 계층의 선형 패스가 이어서 처리한다
+     */
+    void ApplyHierarchyComponentToWorld(const FTransform& NewComponentToWorld, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+    {
+        const bool bHasChanged = !ComponentToWorld.Equals(NewComponentToWorld, UE_SMALL_NUMBER);
+        bComponentToWorldUpdated = true;
+        if (bHasChanged)
+        {
+            ComponentToWorld = NewComponentToWorld;
+        }
+        PropagateTransformUpdateToSelf(bHasChanged, UpdateTransformFlags, Teleport);
+    }
+
+	ENGINE_API void PropagateTransformUpdate(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags = EUpdateTransformFlags::None, ETeleportType Teleport = ETeleportType::None)
+    {
+        //...
+        PropagateTransformUpdateToSelf(bTransformChanged, UpdateTransformFlags, Teleport);
+        UpdateChildTransforms(UpdateTransformFlags, Teleport);
+        //...
+    }
+
+    /**
+     * PropagateTransformUpdate에서 자식 재귀를 뺀, 이 컴포넌트 자신에 대한 처리
+     * kwakkh : 재귀 경로와 계층 경로가 같이 쓴다. 겹침(overlap)은 기존과 같이 MoveComponent의 UpdateOverlaps가 (최신 값을 읽어서) 처리한다
+     */
+    void PropagateTransformUpdateToSelf(bool bTransformChanged, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+    {
+        if (bTransformChanged)
+        {
+            UpdateBounds();
+            OnUpdateTransform(UpdateTransformFlags, Teleport);
+            TransformUpdated.Broadcast(this, UpdateTransformFlags, Teleport);
+            MarkRenderTransformDirty();
+
+            // Refresh navigation
+            if (bNavigationRelevant && bRegistered)
+            {
+                UpdateNavigationData();
+            }
+
+            if (bShouldUpdatePhysicsVolume)
+            {
+                UpdatePhysicsVolume(false);
+            }
+        }
+        else
+        {
+            UpdateBounds();
+            MarkRenderTransformDirty();
+        }
+    }
+
+	ENGINE_API bool AttachToComponent(USceneComponent* InParent, const FAttachmentTransformRules& AttachmentRules, FName InSocketName = NAME_None)
+    {
+        //...
+        // kwakkh : 부착 트리가 바뀌었으므로 계층의 순서를 다시 만든다 (부모/소켓이 계층 밖이면 이 노드가 서브트리 루트가 된다)
+        if (OwningTransformHierarchy)
+        {
+            OwningTransformHierarchy->MarkStructureDirty();
+        }
+        //...
+    }
+
+	ENGINE_API virtual void DetachFromComponent(const FDetachmentTransformRules& DetachmentRules)
+    {
+        //...
+        if (OwningTransformHierarchy)
+        {
+            OwningTransformHierarchy->MarkStructureDirty();
+        }
+        //...
+    }
+
+    /** Set which parts of the relative transform should be relative to parent, and which should be relative to world */
+	ENGINE_API void SetAbsolute(bool bNewAbsoluteLocation = false, bool bNewAbsoluteRotation = false, bool bNewAbsoluteScale = false)
+    {
+        //...
+        // kwakkh : 절대(Absolute) 플래그는 계층 재구성 때 노드별로 복사해 두므로 다시 만든다
+        if (OwningTransformHierarchy)
+        {
+            OwningTransformHierarchy->MarkStructureDirty();
+        }
+        //...
+    }
+
     // 18 - Foundation - CreateWorld - USceneComponent's member variables
     // kwakkh : AttachParent와 AttachChildren을 통해, 씬 그래프(scene-graph)를 위한 트리 구조(tree-structure)를 지원한다.
 
@@ -32,4 +179,333 @@ class USceneComponent : public UActorComponent
     /** List of child SceneComponents that are attached to us. */
 	UPROPERTY(ReplicatedUsing = OnRep_AttachChildren, Transient)
 	TArray<TObjectPtr<USceneComponent>> AttachChildren;
-};
\ No newline at end of file
+
+    friend struct FSceneTransformHierarchy;
+
+    /** Add할 때의 월드 FSceneTransformHierarchy. 계층에 등록되어 있지 않으면 nullptr */
+	FSceneTransformHierarchy* OwningTransformHierarchy = nullptr;
+
+    /** OwningTransformHierarchy 안에서의 인덱스. 계층에 등록되어 있지 않으면 INDEX_NONE */
+	int32 TransformHierarchyIndex = INDEX_NONE;
+};
+
+/**
+ * 월드 단위로 평평하게(flattened) 펼친 SceneComponent 트랜스폼 계층 구조.
+ * 부착 트리를 전위 순회(DFS pre-order) 순서로 배열에 펼치므로, 모든 서브트리는 [Index, SubtreeEnds[Index]) 연속 구간이다.
+ *
+ * kwakkh
+ * - AttachParent/AttachChildren 트리를 재귀로 따라가며 트랜스폼을 갱신하면(UpdateChildTransforms), 노드마다 포인터를 쫓아다녀야 한다.
+ * - 전위 순서 배열에서는 "부모가 이미 계산되어 있다"가 보장되므로, 배열을 앞에서 뒤로 한 번만 훑으면 된다.
+ *   - 부모 월드 트랜스폼은 WorldTransforms 배열에서 읽는다. (부모 컴포넌트를 따라가지 않음)
+ * - UpdateComponentToWorld는 MarkDirty로 서브트리 루트만 모아두고, Flush가 모인 루트들을 한 번의 선형 패스로 처리한다.
+ *   - 같은 프레임에 부모와 자식이 각각 움직여도 자식 서브트리는 한 번만 계산된다.
+ *   - Flush 시점: UWorld::Tick의 TG_StartPhysics 직전, UWorld::SendAllEndOfFrameUpdates,
+ *     그리고 계층 멤버의 GetComponentTransform이 불릴 때. (읽는 쪽은 항상 최신 값을 본다)
+ * - 배열로 표현할 수 없는 경우
+ *   - 절대 위치/회전/스케일: 노드별 플래그로 복사해 두고 CalcNewComponentToWorld_GeneralCase와 같이 처리
+ *   - 소켓 부착 / 부모가 계층 밖: "외부 부모" 노드로 표시하고, 부모 월드를 AttachParent->GetSocketTransform으로 구한다.
+ *     (부모가 같은 패스에서 먼저 반영되므로 소켓 트랜스폼도 최신 값이다)
+ * - 부착 / 등록 / 절대 플래그가 바뀌면 구조만 dirty로 표시하고, 다음 Flush에서 패스 전에 한 번에 다시 펼친다.
+ *
+ *  Diagram:
+ *    Root0 ─┬─ A ─── C            Index:      0      1    2    3    4
+ *           └─ B                  Node:     [Root0, A,   C,   B,   Root1]
+ *    Root1                        Parent:   [ -1,   0,   1,   0,   -1   ]
+ *                                 SubtreeEnd:[ 4,    3,   3,   4,   5    ]
+ *
+ *    MarkDirty(A), MarkDirty(C) → Flush: Index 1..3 구간만 훑는다 (A 계산 → C는 부모 A가 계산되었으므로 한 번만 계산)
+ */
+struct FSceneTransformHierarchy
+{
+    enum EFlags : uint8
+    {
+        AbsoluteLocation = 1 << 0,
+        AbsoluteRotation = 1 << 1,
+        AbsoluteScale    = 1 << 2,
+
+        /** 부모가 계층 밖이거나 소켓에 부착됨. 부모 월드를 GetSocketTransform으로 구한다 */
+        ExternalParent   = 1 << 3,
+    };
+
+    /** 등록된 컴포넌트를 추가. 실제 위치는 다음 Rebuild에서 정해진다 */
+    void Add(USceneComponent* Component)
+    {
+        check(Component->OwningTransformHierarchy == nullptr);
+        Component->OwningTransformHierarchy = this;
+        Component->TransformHierarchyIndex = Components.Add(Component);
+        ParentIndices.Add(INDEX_NONE);
+        SubtreeEnds.Add(Components.Num());
+        WorldTransforms.Add(Component->ComponentToWorld);
+        NodeFlags.Add(ExternalParent);
+        bStructureDirty = true;
+    }
+
+    /** 컴포넌트를 제거. 자식들은 다음 Rebuild에서 "외부 부모" 서브트리 루트가 된다 */
+    void Remove(USceneComponent* Component)
+    {
+        check(Component->OwningTransformHierarchy == this);
+        const int32 Index = Component->TransformHierarchyIndex;
+        check(Components[Index] == Component);
+        Components[Index] = nullptr;
+        Component->TransformHierarchyIndex = INDEX_NONE;
+        Component->OwningTransformHierarchy = nullptr;
+        PendingRoots.RemoveAllSwap([Component](const FPendingRoot& Pending) { return Pending.Component == Component; });
+        bStructureDirty = true;
+    }
+
+    /** 부착 관계나 절대 플래그가 바뀌었음을 알린다 */
+    void MarkStructureDirty()
+    {
+        bStructureDirty = true;
+    }
+
+    /** Component와 그 하위 컴포넌트들을 다음 Flush에서 다시 계산하도록 표시한다 */
+    void MarkDirty(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+    {
+        check(Component->OwningTransformHierarchy == this);
+        PendingRoots.Add({ Component, UpdateTransformFlags, Teleport });
+    }
+
+    bool HasPendingUpdates() const
+    {
+        return PendingRoots.Num() > 0;
+    }
+
+    /**
+     * 표시된 서브트리들의 월드 트랜스폼을 다시 계산하고 각 컴포넌트에 반영한다.
+     * kwakkh : OnUpdateTransform 등에서 다른 컴포넌트를 움직이면 MarkDirty가 재진입한다
+     *  - 패스 도중에는 인덱스를 바꾸지 않고 PendingRoots에만 쌓아두며, 패스가 끝나면 (필요하면 Rebuild한 뒤) 다음 패스로 처리한다
+     *  - 패스 도중의 Flush(GetComponentTransform 등)는 바로 돌아간다. 전위 순서라 부모는 이미 반영되어 있다
+     */
+    void Flush()
+    {
+        if (bFlushing)
+        {
+            return;
+        }
+
+        TGuardValue<bool> FlushGuard(bFlushing, true);
+        while (PendingRoots.Num() > 0)
+        {
+            if (bStructureDirty)
+            {
+                Rebuild();
+            }
+            RunDirtyPass();
+        }
+    }
+
+private:
+    struct FPendingRoot
+    {
+        USceneComponent* Component;
+        EUpdateTransformFlags UpdateTransformFlags;
+        ETeleportType Teleport;
+    };
+
+    /** 모인 루트들을 포함하는 최소 구간을 앞에서 뒤로 한 번 훑는다. 루트이거나 부모가 이번 패스에서 계산된 노드만 계산한다 */
+    void RunDirtyPass()
+    {
+        const int32 Num = Components.Num();
+        PassDirty.Reset();
+        PassDirty.SetNumZeroed(Num);
+        PassFlags.SetNumUninitialized(Num);
+        PassTeleport.SetNumUninitialized(Num);
+
+        int32 First = Num;
+        int32 Last = 0;
+        for (const FPendingRoot& Pending : PendingRoots)
+        {
+            const int32 Index = Pending.Component->TransformHierarchyIndex;
+            if (PassDirty[Index])
+            {
+                // 같은 노드가 여러 번 표시됨: 한 번이라도 물리 갱신을 요청했으면 하고, 텔레포트도 하나라도 요청했으면 한다
+                if (!EnumHasAnyFlags(Pending.UpdateTransformFlags, EUpdateTransformFlags::SkipPhysicsUpdate))
+                {
+                    EnumRemoveFlags(PassFlags[Index], EUpdateTransformFlags::SkipPhysicsUpdate);
+                }
+                PassTeleport[Index] = FMath::Max(PassTeleport[Index], Pending.Teleport);
+                continue;
+            }
+
+            PassDirty[Index] = true;
+            PassFlags[Index] = Pending.UpdateTransformFlags;
+            PassTeleport[Index] = Pending.Teleport;
+            First = FMath::Min(First, Index);
+            Last = FMath::Max(Last, SubtreeEnds[Index]);
+        }
+        PendingRoots.Reset();
+
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            const int32 ParentIndex = ParentIndices[Index];
+            if (!PassDirty[Index])
+            {
+                if (ParentIndex == INDEX_NONE || !PassDirty[ParentIndex])
+                {
+                    continue;
+                }
+
+                // kwakkh : 부모가 움직여서 따라 움직이는 노드. 기존 UpdateChildTransforms와 같이 PropagateFromParent를 붙인다
+                PassDirty[Index] = true;
+                PassFlags[Index] = PassFlags[ParentIndex] | EUpdateTransformFlags::PropagateFromParent;
+                PassTeleport[Index] = PassTeleport[ParentIndex];
+            }
+
+            USceneComponent* Node = Components[Index];
+            if (!Node)
+            {
+                // 이번 패스 도중 등록 해제됨: 자식들은 다음 Rebuild 뒤에 외부 부모 루트로 갱신된다
+                PassDirty[Index] = false;
+                continue;
+            }
+
+            const uint8 Flags = NodeFlags[Index];
+            const FTransform& Relative = Node->GetRelativeTransform();
+
+            if (Flags & ExternalParent)
+            {
+                USceneComponent* AttachParent = Node->GetAttachParent();
+                WorldTransforms[Index] = AttachParent ? Compose(Relative, AttachParent->GetSocketTransform(Node->GetAttachSocketName()), Flags) : Relative;
+            }
+            else
+            {
+                WorldTransforms[Index] = Compose(Relative, WorldTransforms[ParentIndex], Flags);
+            }
+
+            // 콜백 안에서 Add가 일어나면 배열이 재할당될 수 있으므로 복사본을 넘긴다
+            const FTransform NewComponentToWorld = WorldTransforms[Index];
+            Node->ApplyHierarchyComponentToWorld(NewComponentToWorld, PassFlags[Index], PassTeleport[Index]);
+        }
+    }
+
+    /** CalcNewComponentToWorld_GeneralCase와 같은 계산 */
+    static FTransform Compose(const FTransform& Relative, const FTransform& ParentToWorld, uint8 Flags)
+    {
+        if ((Flags & (AbsoluteLocation | AbsoluteRotation | AbsoluteScale)) == 0)
+        {
+            return Relative * ParentToWorld;
+        }
+
+        FTransform Result = Relative * ParentToWorld;
+        if (Flags & AbsoluteLocation)
+        {
+            Result.CopyTranslation(Relative);
+        }
+        if (Flags & AbsoluteRotation)
+        {
+            Result.CopyRotation(Relative);
+        }
+        if (Flags & AbsoluteScale)
+        {
+            Result.CopyScale3D(Relative);
+        }
+        return Result;
+    }
+
+    /**
+     * 제거된 노드를 빼고, 부착 트리를 전위 순회하여 모든 배열과 컴포넌트의 인덱스를 다시 매긴다.
+     * kwakkh : 부모가 계층 밖(또는 nullptr)인 노드가 서브트리 루트. 소켓 부착 자식은 부모의 서브트리 안에 두되 ExternalParent로 표시한다
+     */
+    void Rebuild()
+    {
+        TArray<USceneComponent*> Members;
+        Members.Reserve(Components.Num());
+        for (USceneComponent* Component : Components)
+        {
+            if (Component)
+            {
+                Members.Add(Component);
+            }
+        }
+
+        Components.Reset(Members.Num());
+        ParentIndices.Reset(Members.Num());
+        SubtreeEnds.Reset(Members.Num());
+        WorldTransforms.Reset(Members.Num());
+        NodeFlags.Reset(Members.Num());
+
+        // 방문 표시용: 재구성 중에는 INDEX_NONE이 아닌 임시 값으로 "계층 멤버이지만 아직 배치 안 됨"을 나타낸다
+        constexpr int32 PendingIndex = MAX_int32;
+        for (USceneComponent* Component : Members)
+        {
+            Component->TransformHierarchyIndex = PendingIndex;
+        }
+
+        TArray<TPair<USceneComponent*, int32>, TInlineAllocator<64>> Stack;
+        for (USceneComponent* Root : Members)
+        {
+            USceneComponent* RootParent = Root->GetAttachParent();
+            if (Root->TransformHierarchyIndex != PendingIndex || (RootParent && RootParent->TransformHierarchyIndex != INDEX_NONE))
+            {
+                // 이미 배치되었거나, 부모가 계층 멤버라서 부모의 순회에서 배치된다
+                continue;
+            }
+
+            Stack.Add({ Root, INDEX_NONE });
+            while (Stack.Num() > 0)
+            {
+                const TPair<USceneComponent*, int32> Entry = Stack.Pop(EAllowShrinking::No);
+                USceneComponent* Node = Entry.Key;
+                const int32 ParentIndex = Entry.Value;
+
+                uint8 Flags = 0;
+                Flags |= Node->IsUsingAbsoluteLocation() ? AbsoluteLocation : 0;
+                Flags |= Node->IsUsingAbsoluteRotation() ? AbsoluteRotation : 0;
+                Flags |= Node->IsUsingAbsoluteScale() ? AbsoluteScale : 0;
+                Flags |= (ParentIndex == INDEX_NONE || Node->GetAttachSocketName() != NAME_None) ? ExternalParent : 0;
+
+                const int32 Index = Components.Add(Node);
+                ParentIndices.Add(ParentIndex);
+                SubtreeEnds.Add(INDEX_NONE);
+                WorldTransforms.Add(Node->ComponentToWorld);
+                NodeFlags.Add(Flags);
+                Node->TransformHierarchyIndex = Index;
+
+                // 서브트리 끝은 자식들을 모두 배치한 뒤에 채운다: 음수 마커로 "이 노드의 구간 닫기"를 스택에 넣는다
+                Stack.Add({ Node, -(Index + 2) });
+                for (int32 ChildIndex = Node->GetAttachChildren().Num() - 1; ChildIndex >= 0; --ChildIndex)
+                {
+                    USceneComponent* Child = Node->GetAttachChildren()[ChildIndex];
+                    if (Child && Child->TransformHierarchyIndex == PendingIndex)
+                    {
+                        Stack.Add({ Child, Index });
+                    }
+                }
+
+                while (Stack.Num() > 0 && Stack.Last().Value <= -2)
+                {
+                    SubtreeEnds[-(Stack.Pop(EAllowShrinking::No).Value + 2)] = Components.Num();
+                }
+            }
+        }
+
+        // 부착 트리에 순환이 없으면 모든 멤버가 배치된다
+        check(Components.Num() == Members.Num());
+        bStructureDirty = false;
+    }
+
+    TArray<USceneComponent*> Components;
+    TArray<int32> ParentIndices;
+
+    /** 서브트리 구간의 끝(자신 제외 하위 노드 다음 인덱스) */
+    TArray<int32> SubtreeEnds;
+
+    /** 마지막으로 계산한 월드 트랜스폼. 자식 노드가 부모 컴포넌트 대신 이 배열에서 부모 월드를 읽는다 */
+    TArray<FTransform> WorldTransforms;
+
+    TArray<uint8> NodeFlags;
+
+    /** MarkDirty로 모인, 다음 패스에서 계산할 서브트리 루트들 */
+    TArray<FPendingRoot> PendingRoots;
+
+    /** RunDirtyPass용 노드별 임시 배열. 프레임마다 다시 할당하지 않도록 들고 있는다 */
+    TArray<bool> PassDirty;
+    TArray<EUpdateTransformFlags> PassFlags;
+    TArray<ETeleportType> PassTeleport;
+
+    bool bStructureDirty = false;
+
+    /** Flush 중. 이 동안에는 Rebuild하지 않는다 */
+    bool bFlushing = false;
+};
@@ -0,0 +1,328 @@
+/**
+ * kwakkh
+ * - 엔진 시작 단계(GuardedMain의 PreMainInit, FEngineLoop::PreInit)의 초기화 작업을 의존성 그래프로 실행하는 스타트업 태스크 그래프
+ * - 기존에는 모든 초기화 단계가 메인 스레드에서 순서대로(serial) 실행된다.
+ *   - 서로 의존하지 않는 단계도 앞 단계가 끝날 때까지 기다린다. (코어 수가 많을수록 손해가 크다)
+ * - 모듈 / 델리게이트는 이름과 의존성(먼저 끝나야 하는 태스크 이름)을 선언하고 태스크로 등록한다.
+ *   - 의존성이 없는 태스크끼리는 워커 스레드에서 동시에 실행된다.
+ *   - 의존성이 선언된 태스크 사이의 순서는 항상 보장된다. (결정적 순서)
+ * - 지금은 등록 지점(scaffolding)만 제공한다. 엔진의 기존 초기화 단계는 아직 하나도 옮기지 않았고, 모두 원래 자리에서 순서대로 실행된다.
+ *   - 기존 단계를 옮길 때는 실제 의존성을 선언하고 -StartupTaskValidation으로 누락된 의존성이 없는지 확인한 뒤 옮긴다.
+ */
+
+/**
+ * 0이 아니면 스타트업 태스크들을 워커 스레드에서 병렬로 실행한다. 0이면 결정적인 위상 정렬 순서로 메인 스레드에서 실행 (-StartupTaskParallel)
+ * - 태스크 워커가 아직 없으면(FTaskGraphInterface::IsRunning() == false) 이 값과 상관없이 직렬로 실행한다. PreMainInit 단계는 항상 여기에 해당한다.
+ */
+extern ENGINE_API int32 GStartupTaskGraphParallel;
+
+/**
+ * 검증 모드. 의존성을 선언하지 않은 순서 의존(undeclared ordering dependency)을 찾기 위한 용도. (-StartupTaskValidation[=Seed])
+ * - 0: 끔
+ * - 1: 의존성이 허락하는 범위에서 등록 순서를 뒤집어 직렬 실행
+ * - 2: 의존성이 허락하는 범위에서 GStartupTaskGraphValidationSeed로 섞어서 직렬 실행
+ * - 기본 순서에서는 통과하고 검증 순서에서 실패(check, 크래시, 다른 결과)하는 태스크가 있다면 선언되지 않은 의존성이 있는 것이다.
+ */
+extern ENGINE_API int32 GStartupTaskGraphValidation;
+extern ENGINE_API int32 GStartupTaskGraphValidationSeed;
+
+/** 스타트업 태스크 그래프를 실행하는 엔진 시작 단계 */
+enum class EStartupPhase : uint8
+{
+    /** GuardedMain의 FCoreDelegates::GetPreMainInitDelegate().Broadcast() 직후. 태스크 워커가 시작되기 전이라 항상 직렬로 실행된다 */
+    PreMainInit,
+    /** FEngineLoop::PreInit */
+    PreInit,
+
+    Num,
+};
+
+/** 스타트업 태스크 하나의 선언 */
+struct FStartupTaskDesc
+{
+    FName Name;
+
+    /** 이 태스크보다 먼저 끝나야 하는 태스크 이름들 (같은 단계 안에서만 유효) */
+    TArray<FName> Dependencies;
+
+    TUniqueFunction<void()> Work;
+
+    /** true면 항상 메인(게임) 스레드에서 실행된다 (UObject 생성, 콘솔 변수 등록처럼 스레드 안전하지 않은 작업) */
+    bool bMainThreadOnly = false;
+};
+
+/**
+ * 한 시작 단계의 태스크 의존성 그래프.
+ *
+ * kwakkh
+ * - Run에서 먼저 위상 정렬(Kahn 알고리즘)으로 누락된 의존성과 순환을 검사한다. (실패하면 Fatal)
+ *   - 준비된 태스크가 여럿이면 등록 순서가 빠른 것부터 고른다. -> 직렬 실행 순서가 항상 같다.
+ * - 병렬 실행에서는 남은 의존성 수가 0이 된 태스크를 바로 UE::Tasks로 띄우고,
+ *   bMainThreadOnly 태스크는 메인 스레드 큐에 넣어 Run을 호출한 스레드가 직접 실행한다.
+ *
+ *  Diagram:
+ *    Config ──> Modules(A) ──> Modules(B)
+ *    Paths  ──┘
+ *    Crypto                     (독립 -> Config, Paths와 동시에 실행)
+ */
+class FStartupTaskGraph
+{
+public:
+    static FStartupTaskGraph& Get(EStartupPhase Phase)
+    {
+        static FStartupTaskGraph Graphs[(int32)EStartupPhase::Num];
+        return Graphs[(int32)Phase];
+    }
+
+    void AddTask(FStartupTaskDesc&& Desc)
+    {
+        check(!bHasRun);
+        checkf(!TaskIndexByName.Contains(Desc.Name), TEXT("Startup task %s is registered twice"), *Desc.Name.ToString());
+        TaskIndexByName.Add(Desc.Name, Tasks.Num());
+        Tasks.Add(MoveTemp(Desc));
+    }
+
+    void AddTask(FName Name, TArray<FName> Dependencies, TUniqueFunction<void()>&& Work, bool bMainThreadOnly = false)
+    {
+        AddTask(FStartupTaskDesc{ Name, MoveTemp(Dependencies), MoveTemp(Work), bMainThreadOnly });
+    }
+
+    /** 등록된 태스크를 모두 실행하고 끝날 때까지 기다린다. 메인 스레드에서 단계마다 한 번 호출 */
+    void Run(const TCHAR* PhaseName)
+    {
+        check(IsInGameThread() && !bHasRun);
+        bHasRun = true;
+        if (Tasks.Num() == 0)
+        {
+            return;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        BuildGraph();
+
+        // kwakkh : 워커가 없는데 태스크를 띄우면 아무도 실행하지 않아 영원히 기다리게 되므로, 워커가 돌고 있을 때만 병렬로 실행한다
+        const bool bParallel = GStartupTaskGraphValidation == 0 && GStartupTaskGraphParallel != 0 && FTaskGraphInterface::IsRunning();
+        if (GStartupTaskGraphValidation != 0)
+        {
+            RunSerial(MakeValidationOrder(PhaseName));
+        }
+        else if (bParallel)
+        {
+            RunParallel();
+        }
+        else
+        {
+            RunSerial(DeterministicOrder);
+        }
+
+        UE_LOG(LogInit, Log, TEXT("StartupTaskGraph(%s): %d tasks in %.2f ms (%s)"), PhaseName, Tasks.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0,
+            GStartupTaskGraphValidation != 0 ? TEXT("validation") : (bParallel ? TEXT("parallel") : TEXT("serial")));
+
+        // 시작 단계는 한 번뿐이므로 실행이 끝난 태스크(람다 캡처 포함)는 바로 해제한다
+        Tasks.Empty();
+        TaskIndexByName.Empty();
+        Subsequents.Empty();
+        NumDependencies.Empty();
+        DeterministicOrder.Empty();
+    }
+
+private:
+    /** 의존성 인덱스, 후속 태스크 목록을 만들고 결정적 위상 순서를 구한다. 누락/순환이면 Fatal */
+    void BuildGraph()
+    {
+        Subsequents.SetNum(Tasks.Num());
+        NumDependencies.SetNumZeroed(Tasks.Num());
+        for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+        {
+            for (const FName& DependencyName : Tasks[TaskIndex].Dependencies)
+            {
+                const int32* DependencyIndex = TaskIndexByName.Find(DependencyName);
+                if (!DependencyIndex)
+                {
+                    UE_LOG(LogInit, Fatal, TEXT("Startup task %s depends on unknown task %s"), *Tasks[TaskIndex].Name.ToString(), *DependencyName.ToString());
+                    return;
+                }
+                Subsequents[*DependencyIndex].Add(TaskIndex);
+                ++NumDependencies[TaskIndex];
+            }
+        }
+
+        DeterministicOrder = MakeTopologicalOrder([](TArray<int32>& Ready) { return 0; });
+    }
+
+    /**
+     * Ready 중 하나를 골라 위상 순서를 만든다. PickReady는 (등록 순서로 정렬된) Ready 배열에서 고를 인덱스를 반환한다.
+     * kwakkh : 어떤 것을 고르든 선언된 의존성은 항상 지켜진다. 고르는 방법만 바꿔서 기본 / 역순 / 셔플 순서를 만든다.
+     */
+    template <typename PickReadyType>
+    TArray<int32> MakeTopologicalOrder(PickReadyType&& PickReady) const
+    {
+        TArray<int32> Remaining = NumDependencies;
+        TArray<int32> Ready;
+        for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+        {
+            if (Remaining[TaskIndex] == 0)
+            {
+                Ready.Add(TaskIndex);
+            }
+        }
+
+        TArray<int32> Order;
+        Order.Reserve(Tasks.Num());
+        while (Ready.Num() > 0)
+        {
+            const int32 TaskIndex = Ready[PickReady(Ready)];
+            Ready.Remove(TaskIndex);
+            Order.Add(TaskIndex);
+            for (int32 SubsequentIndex : Subsequents[TaskIndex])
+            {
+                if (--Remaining[SubsequentIndex] == 0)
+                {
+                    Ready.Add(SubsequentIndex);
+                    Ready.Sort();
+                }
+            }
+        }
+
+        if (Order.Num() != Tasks.Num())
+        {
+            FString Cycle;
+            for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+            {
+                if (Remaining[TaskIndex] > 0)
+                {
+                    Cycle += Tasks[TaskIndex].Name.ToString() + TEXT(" ");
+                }
+            }
+            UE_LOG(LogInit, Fatal, TEXT("Startup task graph has a dependency cycle among: %s"), *Cycle);
+        }
+        return Order;
+    }
+
+    /** 검증 모드의 실행 순서. 시드는 재현을 위해 항상 로그로 남긴다 */
+    TArray<int32> MakeValidationOrder(const TCHAR* PhaseName) const
+    {
+        if (GStartupTaskGraphValidation == 1)
+        {
+            UE_LOG(LogInit, Display, TEXT("StartupTaskGraph(%s): validation run in reversed order"), PhaseName);
+            return MakeTopologicalOrder([](TArray<int32>& Ready) { return Ready.Num() - 1; });
+        }
+
+        const int32 Seed = GStartupTaskGraphValidationSeed != 0 ? GStartupTaskGraphValidationSeed : (int32)(FPlatformTime::Cycles() & 0x7fffffff);
+        UE_LOG(LogInit, Display, TEXT("StartupTaskGraph(%s): validation run in shuffled order, seed %d (-StartupTaskValidation=%d to reproduce)"), PhaseName, Seed, Seed);
+        FRandomStream Random(Seed);
+        return MakeTopologicalOrder([&Random](TArray<int32>& Ready) { return Random.RandHelper(Ready.Num()); });
+    }
+
+    void RunSerial(const TArray<int32>& Order)
+    {
+        for (int32 TaskIndex : Order)
+        {
+            ExecuteTask(TaskIndex);
+        }
+    }
+
+    void RunParallel()
+    {
+        RemainingDependencies = MakeUnique<std::atomic<int32>[]>(Tasks.Num());
+        for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+        {
+            RemainingDependencies[TaskIndex].store(NumDependencies[TaskIndex], std::memory_order_relaxed);
+        }
+        NumTasksRemaining.store(Tasks.Num(), std::memory_order_relaxed);
+
+        // 결정적 순서대로 시작 가능한 태스크를 띄운다 (등록 순서가 빠른 것이 먼저 시작)
+        for (int32 TaskIndex : DeterministicOrder)
+        {
+            if (NumDependencies[TaskIndex] == 0)
+            {
+                Dispatch(TaskIndex);
+            }
+        }
+
+        // kwakkh : 메인 스레드는 기다리는 동안 bMainThreadOnly 태스크를 처리한다
+        while (NumTasksRemaining.load(std::memory_order_acquire) > 0)
+        {
+            int32 TaskIndex = INDEX_NONE;
+            {
+                FScopeLock Lock(&MainThreadQueueLock);
+                if (MainThreadQueue.Num() > 0)
+                {
+                    // 먼저 준비된 태스크가 먼저 실행되도록 FIFO
+                    TaskIndex = MainThreadQueue[0];
+                    MainThreadQueue.RemoveAt(0, 1, false);
+                }
+            }
+
+            if (TaskIndex != INDEX_NONE)
+            {
+                ExecuteTaskAndRelease(TaskIndex);
+            }
+            else
+            {
+                MainThreadQueueEvent->Wait(1);
+            }
+        }
+
+        RemainingDependencies.Reset();
+    }
+
+    void Dispatch(int32 TaskIndex)
+    {
+        if (Tasks[TaskIndex].bMainThreadOnly)
+        {
+            {
+                FScopeLock Lock(&MainThreadQueueLock);
+                MainThreadQueue.Add(TaskIndex);
+            }
+            MainThreadQueueEvent->Trigger();
+        }
+        else
+        {
+            UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, TaskIndex]() { ExecuteTaskAndRelease(TaskIndex); });
+        }
+    }
+
+    void ExecuteTask(int32 TaskIndex)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Tasks[TaskIndex].Name.ToString());
+        Tasks[TaskIndex].Work();
+    }
+
+    /** 태스크를 실행하고 후속 태스크의 남은 의존성 수를 줄인다. 0이 된 후속 태스크는 이 스레드가 바로 띄운다 */
+    void ExecuteTaskAndRelease(int32 TaskIndex)
+    {
+        ExecuteTask(TaskIndex);
+
+        for (int32 SubsequentIndex : Subsequents[TaskIndex])
+        {
+            if (RemainingDependencies[SubsequentIndex].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Dispatch(SubsequentIndex);
+            }
+        }
+
+        if (NumTasksRemaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            MainThreadQueueEvent->Trigger();
+        }
+    }
+
+    TArray<FStartupTaskDesc> Tasks;
+    TMap<FName, int32> TaskIndexByName;
+
+    /** [TaskIndex] -> 이 태스크에 의존하는 태스크들 */
+    TArray<TArray<int32>> Subsequents;
+    TArray<int32> NumDependencies;
+    TArray<int32> DeterministicOrder;
+
+    /** 병렬 실행 중에만 유효 */
+    TUniquePtr<std::atomic<int32>[]> RemainingDependencies;
+    std::atomic<int32> NumTasksRemaining = 0;
+
+    FCriticalSection MainThreadQueueLock;
+    TArray<int32> MainThreadQueue;
+    FEventRef MainThreadQueueEvent;
+
+    bool bHasRun = false;
+};
@@ -0,0 +1,525 @@
+/**
+ * kwakkh
+ * - TickTaskManager.cpp / TickTaskManagerInterface.h
+ * - FTickTaskLevel(ULevel::TickTaskLevel)이 모아둔 틱 함수들을 실제로 실행하는 쪽의 발췌
+ */
+
+/**
+ * 0이 아니면 틱 그룹의 틱 함수들을 FTickWorkStealingExecutor로 실행한다.
+ * (tick.WorkStealingExecutor 콘솔 변수로 제어, 값은 사용할 워커 수. 게임 스레드 포함)
+ */
+extern ENGINE_API int32 GTickWorkStealingExecutor;
+
+/**
+ * 한 워커가 소유하는 고정 크기의 lock-free 작업 덱(deque). (Chase-Lev 덱)
+ * - 소유자 워커만 Bottom 쪽에서 Push/Pop 한다. (LIFO, 방금 준비된 틱을 바로 이어서 실행 -> 캐시에 유리)
+ * - 다른 워커들은 Top 쪽에서 Steal 한다. (FIFO, 오래 기다린 틱부터 가져감)
+ * - 충돌은 덱에 원소가 하나 남았을 때만 일어나며, Top에 대한 CAS 한 번으로 해결된다.
+ *
+ * kwakkh
+ * - 한 프레임에 실행될 틱 수를 미리 알기 때문에, 용량을 그만큼 잡아두면 버퍼를 키울 일이 없다.
+ */
+class FTickWorkDeque
+{
+public:
+    void Reset(int32 InCapacity)
+    {
+        const int32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 1));
+        if (Capacity > Mask + 1)
+        {
+            Buffer = MakeUnique<std::atomic<int32>[]>(Capacity);
+            Mask = Capacity - 1;
+        }
+        Top.store(0, std::memory_order_relaxed);
+        Bottom.store(0, std::memory_order_relaxed);
+    }
+
+    /** 소유자 워커 전용 */
+    void Push(int32 Item)
+    {
+        const int64 B = Bottom.load(std::memory_order_relaxed);
+        Buffer[B & Mask].store(Item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Bottom.store(B + 1, std::memory_order_relaxed);
+    }
+
+    /** 소유자 워커 전용 */
+    bool Pop(int32& OutItem)
+    {
+        const int64 B = Bottom.load(std::memory_order_relaxed) - 1;
+        Bottom.store(B, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 T = Top.load(std::memory_order_relaxed);
+
+        if (T > B)
+        {
+            Bottom.store(B + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        OutItem = Buffer[B & Mask].load(std::memory_order_relaxed);
+        if (T == B)
+        {
+            // 마지막 원소 - 도둑(thief)과 경쟁
+            const bool bWon = Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            Bottom.store(B + 1, std::memory_order_relaxed);
+            return bWon;
+        }
+        return true;
+    }
+
+    /** 아무 워커나 호출 가능 */
+    bool Steal(int32& OutItem)
+    {
+        int64 T = Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64 B = Bottom.load(std::memory_order_acquire);
+
+        if (T >= B)
+        {
+            return false;
+        }
+
+        OutItem = Buffer[T & Mask].load(std::memory_order_relaxed);
+        return Top.compare_exchange_strong(T, T + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+private:
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Top{0};
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Bottom{0};
+    TUniquePtr<std::atomic<int32>[]> Buffer;
+    int64 Mask = -1;
+};
+
+/** FTickWorkStealingExecutor가 프레임마다 남기는 워커별 통계 */
+struct FTickWorkerFrameStats
+{
+    int32 NumExecuted = 0;
+
+    /** 다른 워커의 덱에서 훔쳐온 틱 수 */
+    int32 NumSteals = 0;
+
+    /** 다른 워커들의 덱을 한 바퀴 다 돌고도 훔치지 못한 횟수 (경쟁 또는 빈 덱) */
+    int32 NumFailedSteals = 0;
+
+    /** 실행할 틱을 찾지 못하고 기다린 시간 */
+    double IdleSeconds = 0.0;
+};
+
+/**
+ * 틱 그룹 하나의 틱 함수들을 work-stealing 방식으로 실행하는 실행기.
+ *
+ * kwakkh
+ * - 기존에는 준비된 틱 함수들이 몇 개의 공유 큐로 모이고, 모든 워커가 그 큐를 두고 경쟁했다.
+ * - 여기서는 워커마다 자기 덱을 가지고, 자기 덱이 비었을 때만 남의 덱에서 훔쳐온다. (평소에는 경쟁이 없다)
+ * - 선행 조건(Prerequisites)은 락 대신 틱마다 둔 atomic 카운터로 해결한다.
+ *   - 틱이 끝나면 후행 틱들의 카운터를 1씩 줄이고, 0이 된 틱을 자기 덱에 Push 한다.
+ * - bRunOnAnyThread가 아닌 틱은 게임 스레드(워커 0)에서만 실행되어야 하므로, 별도의 lock-free 큐로 게임 스레드에게 넘긴다.
+ * - 틱 실행은 FTickFunctionTask::DoTask와 같은 순서를 따른다. (IsTickFunctionEnabled -> CalculateDeltaTime -> ExecuteTick)
+ *   - 틱마다 완료 이벤트를 만들어 넘기므로 DontCompleteUntil을 쓸 수 있다. 기다릴 이벤트가 남았으면 그 이벤트가 끝난 뒤에 후행 틱을 푼다.
+ * - 할 일이 없는 워커는 점점 길게 쉰다. (pause -> YieldThread -> Sleep)
+ *
+ *  Diagram:
+ *    Worker0(GameThread)   Worker1            Worker2
+ *    ┌────────────┐        ┌────────────┐     ┌────────────┐
+ *    │ Deque0     │◄─steal─┤ Deque1     │     │ Deque2     │
+ *    │  [T3,T7]   │        │  [T1]      ├────►│  []        │ (비어서 Deque1에서 훔침)
+ *    └────────────┘        └────────────┘     └────────────┘
+ *    GameThreadQueue: [T5, T9]  (bRunOnAnyThread == false)
+ */
+class FTickWorkStealingExecutor
+{
+public:
+    /**
+     * TickFunctions를 선행 조건을 지키며 모두 실행하고, 끝날 때까지 반환하지 않는다. 게임 스레드에서 호출해야 한다.
+     * TickFunctions 밖에 있는 선행 틱은 이미 끝난 것으로 간주한다. (이전 틱 그룹)
+     */
+    void ExecuteTicks(TArrayView<FTickFunction* const> TickFunctions, const FTickContext& InContext, int32 NumWorkers)
+    {
+        check(IsInGameThread());
+        NumWorkers = FMath::Clamp(NumWorkers, 1, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+
+        BuildGraph(TickFunctions);
+
+        Workers.SetNum(NumWorkers);
+        for (FWorker& Worker : Workers)
+        {
+            Worker.Deque.Reset(Nodes.Num());
+            Worker.Stats = FTickWorkerFrameStats();
+        }
+
+        // 선행 조건이 없는 틱들을 워커들에게 골고루 나눠준다
+        int32 NextWorker = 0;
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            if (Nodes[NodeIndex].NumPendingPrerequisites.load(std::memory_order_relaxed) == 0)
+            {
+                MakeReady(NodeIndex, NextWorker);
+                NextWorker = (NextWorker + 1) % NumWorkers;
+            }
+        }
+
+        Context = InContext;
+        NumRemainingTicks.store(Nodes.Num(), std::memory_order_release);
+
+        TArray<UE::Tasks::FTask, TInlineAllocator<16>> WorkerTasks;
+        for (int32 WorkerIndex = 1; WorkerIndex < NumWorkers; ++WorkerIndex)
+        {
+            WorkerTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, WorkerIndex] { RunWorker(WorkerIndex); }));
+        }
+        RunWorker(0);
+        UE::Tasks::Wait(WorkerTasks);
+
+        ReportFrameStats();
+    }
+
+    /** 마지막으로 실행한 프레임의 워커별 통계 (인덱스 0 == 게임 스레드) */
+    TArray<FTickWorkerFrameStats> GetLastFrameStats() const
+    {
+        TArray<FTickWorkerFrameStats> Result;
+        for (const FWorker& Worker : Workers)
+        {
+            Result.Add(Worker.Stats);
+        }
+        return Result;
+    }
+
+private:
+    struct FNode
+    {
+        FTickFunction* TickFunction = nullptr;
+        std::atomic<int32> NumPendingPrerequisites{0};
+
+        /** ExecuteTick에 넘기는 완료 이벤트 (MyCompletionGraphEvent) */
+        FGraphEventRef CompletionEvent;
+
+        /** SubsequentIndices 안에서 이 노드의 후행 틱들이 시작하는 위치와 개수 */
+        int32 FirstSubsequent = 0;
+        int32 NumSubsequents = 0;
+    };
+
+    struct FWorker
+    {
+        FTickWorkDeque Deque;
+        FTickWorkerFrameStats Stats;
+    };
+
+    /** 틱 함수 -> 노드 인덱스를 만들고, 후행 틱 목록을 하나의 평평한 배열(CSR 형식)에 담는다 */
+    void BuildGraph(TArrayView<FTickFunction* const> TickFunctions)
+    {
+        Nodes.Reset();
+        Nodes.SetNum(TickFunctions.Num());
+        NodeIndexMap.Reset();
+        for (int32 NodeIndex = 0; NodeIndex < TickFunctions.Num(); ++NodeIndex)
+        {
+            Nodes[NodeIndex].TickFunction = TickFunctions[NodeIndex];
+            NodeIndexMap.Add(TickFunctions[NodeIndex], NodeIndex);
+        }
+
+        // (선행 틱, 후행 틱) 쌍들을 모은 뒤 선행 틱 기준으로 정렬
+        TArray<TPair<int32, int32>> Edges;
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            for (FTickPrerequisite& Prerequisite : Nodes[NodeIndex].TickFunction->GetPrerequisites())
+            {
+                if (const int32* PrerequisiteIndex = NodeIndexMap.Find(Prerequisite.Get()))
+                {
+                    Edges.Emplace(*PrerequisiteIndex, NodeIndex);
+                    Nodes[NodeIndex].NumPendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        Algo::SortBy(Edges, &TPair<int32, int32>::Key);
+
+        SubsequentIndices.Reset(Edges.Num());
+        for (const TPair<int32, int32>& Edge : Edges)
+        {
+            FNode& Prerequisite = Nodes[Edge.Key];
+            if (Prerequisite.NumSubsequents == 0)
+            {
+                Prerequisite.FirstSubsequent = SubsequentIndices.Num();
+            }
+            ++Prerequisite.NumSubsequents;
+            SubsequentIndices.Add(Edge.Value);
+        }
+    }
+
+    /** 준비된 틱을 실행 가능한 곳에 넣는다. 게임 스레드 전용 틱은 GameThreadQueue로 보낸다 */
+    void MakeReady(int32 NodeIndex, int32 WorkerIndex)
+    {
+        if (!Nodes[NodeIndex].TickFunction->bRunOnAnyThread)
+        {
+            GameThreadQueue.Push(&Nodes[NodeIndex]);
+            return;
+        }
+        Workers[WorkerIndex].Deque.Push(NodeIndex);
+    }
+
+    /** 실행할 틱을 찾는다: (게임 스레드라면) GameThreadQueue -> 자기 덱 -> 완료 이벤트를 기다렸다가 풀린 틱 -> 다른 워커의 덱 순서 */
+    bool FindWork(int32 WorkerIndex, int32& OutNodeIndex)
+    {
+        FWorker& Worker = Workers[WorkerIndex];
+
+        if (WorkerIndex == 0)
+        {
+            if (FNode* Node = GameThreadQueue.Pop())
+            {
+                OutNodeIndex = UE_PTRDIFF_TO_INT32(Node - Nodes.GetData());
+                return true;
+            }
+        }
+
+        if (Worker.Deque.Pop(OutNodeIndex))
+        {
+            return true;
+        }
+
+        if (FNode* Node = DeferredReadyQueue.Pop())
+        {
+            OutNodeIndex = UE_PTRDIFF_TO_INT32(Node - Nodes.GetData());
+            return true;
+        }
+
+        if (Workers.Num() > 1)
+        {
+            for (int32 Offset = 1; Offset < Workers.Num(); ++Offset)
+            {
+                const int32 VictimIndex = (WorkerIndex + Offset) % Workers.Num();
+                if (Workers[VictimIndex].Deque.Steal(OutNodeIndex))
+                {
+                    ++Worker.Stats.NumSteals;
+                    return true;
+                }
+            }
+            ++Worker.Stats.NumFailedSteals;
+        }
+        return false;
+    }
+
+    /** FTickFunctionTask::DoTask와 같은 전처리를 거쳐 틱을 실행한다 */
+    void ExecuteNode(FNode& Node, ENamedThreads::Type CurrentThread)
+    {
+        FTickFunction* Target = Node.TickFunction;
+        if (Target->IsTickFunctionEnabled())
+        {
+            Target->ExecuteTick(Target->CalculateDeltaTime(Context.DeltaSeconds, Context.World), Context.TickType, CurrentThread, Node.CompletionEvent);
+        }
+    }
+
+    /** 후행 틱들의 카운터를 줄이고, 0이 된 틱은 준비 상태로 만든다. WorkerIndex가 INDEX_NONE이면 덱 주인이 아닌 스레드에서 호출된 것이다 */
+    void CompleteNode(FNode& Node, int32 WorkerIndex)
+    {
+        for (int32 Index = Node.FirstSubsequent; Index < Node.FirstSubsequent + Node.NumSubsequents; ++Index)
+        {
+            const int32 SubsequentIndex = SubsequentIndices[Index];
+            if (Nodes[SubsequentIndex].NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                if (WorkerIndex != INDEX_NONE)
+                {
+                    MakeReady(SubsequentIndex, WorkerIndex);
+                }
+                else if (!Nodes[SubsequentIndex].TickFunction->bRunOnAnyThread)
+                {
+                    GameThreadQueue.Push(&Nodes[SubsequentIndex]);
+                }
+                else
+                {
+                    // 덱은 주인 워커만 Push할 수 있으므로 공용 큐로 넘긴다
+                    DeferredReadyQueue.Push(&Nodes[SubsequentIndex]);
+                }
+            }
+        }
+
+        NumRemainingTicks.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /** 실행할 틱을 찾지 못한 연속 횟수에 따라 쉰다 */
+    static void Backoff(int32 NumIdleSweeps)
+    {
+        if (NumIdleSweeps < 16)
+        {
+            FPlatformProcess::YieldCycles(uint64(64) << FMath::Min(NumIdleSweeps, 6));
+        }
+        else if (NumIdleSweeps < 64)
+        {
+            FPlatformProcess::YieldThread();
+        }
+        else
+        {
+            FPlatformProcess::SleepNoStats(0.0001f);
+        }
+    }
+
+    void RunWorker(int32 WorkerIndex)
+    {
+        FWorker& Worker = Workers[WorkerIndex];
+        const ENamedThreads::Type CurrentThread = (WorkerIndex == 0) ? ENamedThreads::GameThread : ENamedThreads::AnyThread;
+
+        double IdleStartTime = 0.0;
+        int32 NumIdleSweeps = 0;
+        while (NumRemainingTicks.load(std::memory_order_acquire) > 0)
+        {
+            int32 NodeIndex = INDEX_NONE;
+            if (!FindWork(WorkerIndex, NodeIndex))
+            {
+                if (IdleStartTime == 0.0)
+                {
+                    IdleStartTime = FPlatformTime::Seconds();
+                }
+                Backoff(NumIdleSweeps++);
+                continue;
+            }
+
+            if (IdleStartTime != 0.0)
+            {
+                Worker.Stats.IdleSeconds += FPlatformTime::Seconds() - IdleStartTime;
+                IdleStartTime = 0.0;
+            }
+            NumIdleSweeps = 0;
+
+            FNode& Node = Nodes[NodeIndex];
+            Node.CompletionEvent = FGraphEvent::CreateGraphEvent();
+            ExecuteNode(Node, CurrentThread);
+            ++Worker.Stats.NumExecuted;
+
+            // kwakkh : ExecuteTick 안에서 DontCompleteUntil로 기다릴 이벤트가 추가되었으면, DispatchSubsequents가 그 이벤트들을 기다린 뒤에 완료한다
+            Node.CompletionEvent->DispatchSubsequents(CurrentThread);
+            if (Node.CompletionEvent->IsComplete())
+            {
+                // 후행 틱 중 0이 된 틱은 자기 덱에 넣어 바로 이어서 실행한다
+                CompleteNode(Node, WorkerIndex);
+            }
+            else
+            {
+                FFunctionGraphTask::CreateAndDispatchWhenReady([this, &Node] { CompleteNode(Node, INDEX_NONE); }, TStatId(), Node.CompletionEvent);
+            }
+        }
+
+        if (IdleStartTime != 0.0)
+        {
+            Worker.Stats.IdleSeconds += FPlatformTime::Seconds() - IdleStartTime;
+        }
+    }
+
+    void ReportFrameStats() const
+    {
+        for (int32 WorkerIndex = 0; WorkerIndex < Workers.Num(); ++WorkerIndex)
+        {
+            const FTickWorkerFrameStats& Stats = Workers[WorkerIndex].Stats;
+            UE_LOG(LogTick, VeryVerbose, TEXT("TickWorker %d: Executed=%d Steals=%d FailedSteals=%d Idle=%.3fms"),
+                WorkerIndex, Stats.NumExecuted, Stats.NumSteals, Stats.NumFailedSteals, Stats.IdleSeconds * 1000.0);
+        }
+    }
+
+    TArray<FNode> Nodes;
+    TMap<FTickFunction*, int32> NodeIndexMap;
+    TArray<int32> SubsequentIndices;
+    TArray<FWorker> Workers;
+
+    /** 게임 스레드에서만 실행해야 하는 준비된 틱들 (여러 워커가 Push, 게임 스레드만 Pop) */
+    TLockFreePointerListUnordered<FNode, PLATFORM_CACHE_LINE_SIZE> GameThreadQueue;
+
+    /** 완료 이벤트를 기다렸다가 (워커가 아닌 스레드에서) 풀린 bRunOnAnyThread 틱들. 아무 워커나 Pop */
+    TLockFreePointerListUnordered<FNode, PLATFORM_CACHE_LINE_SIZE> DeferredReadyQueue;
+
+    std::atomic<int32> NumRemainingTicks{0};
+
+    /** 이번 그룹의 틱 컨텍스트 (DeltaSeconds, TickType, World) */
+    FTickContext Context;
+};
+
+/** FTickTaskSequencer 발췌 */
+class FTickTaskSequencer
+{
+public:
+    //...
+
+    /** nullptr이 아니면 QueueTickFunction이 태스크를 만들지 않고 실제 시작 틱 그룹별 목록(TG_MAX개)에 모은다. FTickTaskManager::StartFrame이 설정 */
+    TArray<FTickFunction*>* ExecutorTicksByGroup = nullptr;
+};
+
+/**
+ * FTickFunction::QueueTickFunction 발췌
+ * kwakkh : 선행 틱을 먼저 큐에 넣어 실제 시작 틱 그룹(ActualStartTickGroup)을 정한 뒤,
+ *          실행기 모드라면 태스크 그래프 태스크를 만드는 대신 그 그룹의 목록에 모은다.
+ */
+void FTickFunction::QueueTickFunction(FTickTaskSequencer& TTS, const FTickContext& TickContext)
+{
+    //...
+    // 선행 틱들을 먼저 큐에 넣고, 그중 가장 늦은 틱 그룹까지 시작을 미룬다
+    TEnumAsByte<enum ETickingGroup> MaxStartTickGroup = TickGroup;
+    for (FTickPrerequisite& Prereq : Prerequisites)
+    {
+        FTickFunction* Prereq_Function = Prereq.Get();
+        if (Prereq_Function && Prereq_Function->bRegistered)
+        {
+            Prereq_Function->QueueTickFunction(TTS, TickContext);
+            MaxStartTickGroup = FMath::Max<ETickingGroup>(MaxStartTickGroup, Prereq_Function->InternalData->ActualStartTickGroup.GetValue());
+        }
+    }
+    InternalData->ActualStartTickGroup = MaxStartTickGroup;
+    InternalData->ActualEndTickGroup = FMath::Max<ETickingGroup>(EndTickGroup, MaxStartTickGroup);
+
+    if (TTS.ExecutorTicksByGroup)
+    {
+        // kwakkh : 선행 틱은 같은 그룹이거나 앞선 그룹에 있으므로, 그룹 순서대로 ExecuteTicks 하면 선행 조건이 지켜진다
+        TTS.ExecutorTicksByGroup[InternalData->ActualStartTickGroup].Add(this);
+        return;
+    }
+    //... (기존 태스크 그래프 경로: StartTickTask / AddTickTaskCompletion)
+}
+
+/**
+ * FTickTaskManager 발췌
+ * kwakkh : StartFrame에서 GTickWorkStealingExecutor를 한 번 읽어 프레임 단위로 고정한다. (프레임 도중에 값이 바뀌어도 그룹마다 실행 경로가 섞이지 않음)
+ */
+class FTickTaskManager : public FTickTaskManagerInterface
+{
+public:
+    virtual void StartFrame(UWorld* InWorld, float InDeltaSeconds, ELevelTick InTickType, const TArray<ULevel*>& LevelsToTick) override
+    {
+        //...
+        ExecutorNumWorkers = GTickWorkStealingExecutor;
+        TickTaskSequencer.ExecutorTicksByGroup = (ExecutorNumWorkers > 0) ? ExecutorTicksByGroup : nullptr;
+
+        for (int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++)
+        {
+            LevelList[LevelIndex]->QueueAllTicks();
+        }
+        //...
+    }
+
+    virtual void RunTickGroup(ETickingGroup Group, bool bBlockTillComplete) override
+    {
+        check(Context.TickGroup == Group); // this should already be at the correct value, but we want to make sure things are happening in the right order
+        check(bTickNewlySpawned); // we should be in the middle of ticking
+
+        if (ExecutorNumWorkers > 0)
+        {
+            // kwakkh : 이 그룹에서 시작하는 틱들을 모두 실행하고 반환한다. 그룹 경계에서 항상 끝나므로 bBlockTillComplete와 무관하게 완료된 상태다
+            TArray<FTickFunction*>& GroupTicks = ExecutorTicksByGroup[Group];
+            WorkStealingExecutor.ExecuteTicks(GroupTicks, Context, ExecutorNumWorkers);
+            GroupTicks.Reset();
+        }
+        else
+        {
+            TickTaskSequencer.ReleaseTickGroup(Group, bBlockTillComplete);
+        }
+        Context.TickGroup = ETickingGroup(Context.TickGroup + 1); // new actors go into the next tick group because this one is already gone
+        //... (bBlockTillComplete면 새로 스폰된 액터들의 틱 처리)
+    }
+
+private:
+    FTickTaskSequencer& TickTaskSequencer;
+    TArray<FTickTaskLevel*> LevelList;
+    FTickContext Context;
+    bool bTickNewlySpawned;
+
+    /** 이번 프레임의 실행기 워커 수. 0이면 기존 태스크 그래프 경로 */
+    int32 ExecutorNumWorkers = 0;
+
+    /** 실행기 모드에서 실제 시작 틱 그룹별로 모은 틱 함수들 (FTickTaskSequencer::ExecutorTicksByGroup이 가리킨다) */
+    TArray<FTickFunction*> ExecutorTicksByGroup[TG_MAX];
+
+    FTickWorkStealingExecutor WorkStealingExecutor;
+};
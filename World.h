@@ -21,7 +21,54 @@ struct FWorldInitializationValues
     /** 이 월드 내에서 충돌 트레이스(Collision Trace) 호출이 유효한지 여부 */
 	uint32 bEnableTraceCollision:1;
 
+    /** 내비게이션 시스템을 생성해야 하는지 여부 */
+	uint32 bCreateNavigation:1;
+
+    /** AI 시스템을 생성해야 하는지 여부 */
+	uint32 bCreateAISystem:1;
+
     //...
+
+    /** 
+     * 두 초기화 값으로 만든 월드를 서로 바꿔 써도 되는지 비교. (FWorldPool의 키로 사용)
+     * kwakkh : 월드 생성 결과에 영향을 주는 플래그들만 비교한다.
+     */
+	bool IsEquivalentForPooling(const FWorldInitializationValues& Other) const
+    {
+        return bInitializeScenes == Other.bInitializeScenes
+            && bCreatePhysicsScene == Other.bCreatePhysicsScene
+            && bEnableTraceCollision == Other.bEnableTraceCollision
+            && bCreateNavigation == Other.bCreateNavigation
+            && bCreateAISystem == Other.bCreateAISystem;
+    }
+
+	uint32 GetPoolingHash() const
+    {
+        return (bInitializeScenes << 0) | (bCreatePhysicsScene << 1) | (bEnableTraceCollision << 2) | (bCreateNavigation << 3) | (bCreateAISystem << 4);
+    }
+};
+
+/** 
+ * UWorld::InitializeNewWorld에서 월드를 구성하는 단계들.
+ * 각 단계는 FWorldInitializationValues의 플래그에 따라 생략될 수 있다.
+ */
+enum class EWorldInitStage : uint8
+{
+	PhysicsScene,	// FPhysScene 생성 (bInitializeScenes && bCreatePhysicsScene)
+	Navigation,		// 내비게이션 시스템 생성 (bCreateNavigation)
+	AISystem,		// AI 시스템 생성 (bCreateAISystem), 내비게이션 이후
+	LineBatchers,	// 디버그 라인 배치기 생성
+	Subsystems,		// UWorldSubsystem 초기화, 위의 모든 단계 이후
+	Num
+};
+
+/** 월드 초기화 단계별 소요 시간. 시간은 초기화 시작 시점 기준의 초 단위 */
+struct FWorldInitStageTiming
+{
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+	bool bRan = false;
+	bool bRanOnGameThread = false;
 };
 
 /** Subsystems은 특정 엔진 구조체의 생명 주기(lifetime)를 공유하는 자동 인스턴스화(auto instanced) 클래스
@@ -92,6 +139,15 @@ class USubsystem : public UObject
 	/** Implement this for deinitialization of instances of the system */
 	virtual void Deinitialize() {}
 
+    /** 
+     * 지연 초기화(lazy) 모드의 컬렉션에서도 컬렉션 초기화 시점에 바로 생성되어야 하면 true를 반환하도록 오버라이드.
+     * Initialize에서 InitializeDependency로 다른 서브시스템에 의존하거나, 델리게이트 바인딩/틱 등록처럼 
+     * 누가 GetSubsystem을 호출하지 않아도 동작해야 하는 서브시스템은 반드시 true를 반환해야 한다.
+     * 
+     * Note: ShouldCreateSubsystem과 마찬가지로 CDO에서 호출된다!
+     */
+	virtual bool RequiresEagerInitialization() const { return false; }
+
 private:
     // haker: we are interested UWorld's [FObjectSubsystemCollection<UWorldSubsystem>]
     // - each subsystem has its owner like this
@@ -99,6 +155,59 @@ private:
     FSubsystemCollectionBase* InternalOwningSubsystem;
 }
 
+/** UWorldSubsystem이 매 프레임 실행될 수 있는 단계들. UWorld::Tick 안의 해당 시점에서 실행된다 */
+enum class EWorldSubsystemTickPhase : uint8
+{
+	PrePhysics,		// TG_PrePhysics 틱 그룹 직전
+	PostPhysics,	// TG_PostPhysics 틱 그룹 직후
+	PostUpdateWork,	// TG_PostUpdateWork 틱 그룹 직후
+	Num
+};
+
+/**
+ * 서브시스템이 한 틱 단계에서 읽고 쓰는 데이터의 선언.
+ * 이름(FName)은 서브시스템들 사이에서 합의된 임의의 리소스 이름이다. (e.g. "Navigation", "Crowd", "Perception")
+ * 
+ * kwakkh
+ * - 두 서브시스템이 서로의 쓰기 집합과 겹치지 않으면 동시에 실행해도 안전하다. (읽기끼리는 겹쳐도 된다)
+ * - bAllowParallel이 false인 서브시스템은 선언과 상관없이 게임 스레드에서만 실행된다.
+ */
+struct FWorldSubsystemTickAccess
+{
+	TArray<FName, TInlineAllocator<4>> Reads;
+	TArray<FName, TInlineAllocator<4>> Writes;
+
+    /** true이면 워커 스레드에서 다른 서브시스템과 동시에 실행될 수 있다 */
+	bool bAllowParallel = false;
+
+	bool ConflictsWith(const FWorldSubsystemTickAccess& Other) const
+    {
+        for (const FName& Write : Writes)
+        {
+            if (Other.Writes.Contains(Write) || Other.Reads.Contains(Write))
+            {
+                return true;
+            }
+        }
+        for (const FName& Write : Other.Writes)
+        {
+            if (Reads.Contains(Write))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/** 서브시스템별 틱 시간 통계 */
+struct FWorldSubsystemTickStats
+{
+	double LastTickSeconds = 0.0;
+	double TotalTickSeconds = 0.0;
+	int32 NumTicks = 0;
+};
+
 /**
  * UWorldSubsystem
  * UWorld와 생명 주기를 공유하며 자동으로 인스턴스화(instanced)되고 초기화되는 시스템들의 기본 클래스
@@ -111,10 +220,630 @@ class UWorldSubsystem : public USubsystem
 {
 	GENERATED_BODY()
 
+    /** 모든 UWorldSubsystem들이 초기화된 후에 호출된다. */
+	virtual void PostInitialize() {}
+
     /** 월드 컴포넌트들(예: 라인 배치기 및 모든 레벨 컴포넌트들)의 업데이트가 완료된 후에 호출된다. */
 	virtual void OnWorldComponentsUpdated(UWorld& World) {}
+
+    /** 월드가 BeginPlay를 시작할 때 호출된다. */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) {}
+
+    /** 
+     * Phase 단계에서 틱하려면 true를 반환하고 OutAccess에 읽기/쓰기 집합을 채운다. (서브시스템 목록이 바뀔 때만 호출된다)
+     * 각자 틱 함수를 등록하는 대신 이 선언을 사용하면, 월드가 충돌하지 않는 서브시스템들을 같은 단계 안에서 병렬로 실행한다.
+     */
+	virtual bool GetTickPhaseAccess(EWorldSubsystemTickPhase Phase, FWorldSubsystemTickAccess& OutAccess) const { return false; }
+
+    /** GetTickPhaseAccess에서 true를 반환한 단계마다 한 번씩 호출된다. bAllowParallel이면 워커 스레드에서 호출될 수 있다 */
+	virtual void TickPhase(EWorldSubsystemTickPhase Phase, float DeltaTime) {}
 }
 
+/**
+ * 월드 서브시스템들의 틱 단계를 실행하는 스케줄러. (UWorld::SubsystemTickScheduler)
+ * 
+ * kwakkh
+ * - 서브시스템 목록이 바뀌면 단계별로 "웨이브(wave)"를 다시 만든다.
+ *   - 한 웨이브 안의 서브시스템들은 서로 충돌하지 않는다. (탐욕적으로 앞 웨이브부터 채워 넣음)
+ * - 실행할 때는 웨이브 순서대로, 웨이브 안에서 bAllowParallel인 것들은 ParallelFor로, 나머지는 게임 스레드에서 실행한다.
+ * 
+ *  Diagram (PostPhysics):
+ *    Wave0: [Crowd(W:Crowd), Perception(R:Nav W:Perception)]   ── 병렬
+ *    Wave1: [NavUpdate(W:Nav)]                                  ── Perception과 충돌하므로 다음 웨이브
+ */
+struct FWorldSubsystemTickScheduler
+{
+	void Rebuild(TArrayView<UWorldSubsystem* const> Subsystems)
+    {
+        for (int32 PhaseIndex = 0; PhaseIndex < (int32)EWorldSubsystemTickPhase::Num; ++PhaseIndex)
+        {
+            TArray<FWave>& Waves = PhaseWaves[PhaseIndex];
+            Waves.Reset();
+
+            for (UWorldSubsystem* Subsystem : Subsystems)
+            {
+                FWorldSubsystemTickAccess Access;
+                if (!Subsystem->GetTickPhaseAccess((EWorldSubsystemTickPhase)PhaseIndex, Access))
+                {
+                    continue;
+                }
+
+                // 충돌하지 않는 첫 번째 웨이브에 넣는다. 단, 선언 순서를 지키기 위해 충돌한 웨이브보다 앞에는 넣지 않는다.
+                int32 TargetWave = 0;
+                for (int32 WaveIndex = 0; WaveIndex < Waves.Num(); ++WaveIndex)
+                {
+                    if (Waves[WaveIndex].Accesses.ContainsByPredicate([&Access](const FWorldSubsystemTickAccess& Other) { return Access.ConflictsWith(Other); }))
+                    {
+                        TargetWave = WaveIndex + 1;
+                    }
+                }
+                if (TargetWave == Waves.Num())
+                {
+                    Waves.AddDefaulted();
+                }
+
+                FWave& Wave = Waves[TargetWave];
+                (Access.bAllowParallel ? Wave.ParallelSubsystems : Wave.GameThreadSubsystems).Add(Subsystem);
+                Wave.Accesses.Add(MoveTemp(Access));
+                Stats.FindOrAdd(Subsystem);
+            }
+        }
+    }
+
+    /** Phase에 워커 스레드에서 실행될 서브시스템이 있는지 여부 */
+	bool HasParallelWork(EWorldSubsystemTickPhase Phase) const
+    {
+        return PhaseWaves[(int32)Phase].ContainsByPredicate([](const FWave& Wave) { return Wave.ParallelSubsystems.Num() > 0; });
+    }
+
+	void RunPhase(EWorldSubsystemTickPhase Phase, float DeltaTime)
+    {
+        check(IsInGameThread());
+        for (FWave& Wave : PhaseWaves[(int32)Phase])
+        {
+            ParallelFor(Wave.ParallelSubsystems.Num(), [this, &Wave, Phase, DeltaTime](int32 Index)
+            {
+                TickSubsystem(Wave.ParallelSubsystems[Index], Phase, DeltaTime);
+            });
+
+            for (UWorldSubsystem* Subsystem : Wave.GameThreadSubsystems)
+            {
+                TickSubsystem(Subsystem, Phase, DeltaTime);
+            }
+        }
+    }
+
+	const FWorldSubsystemTickStats* GetStats(const UWorldSubsystem* Subsystem) const
+    {
+        return Stats.Find(Subsystem);
+    }
+
+    /** 서브시스템 목록의 변경을 감지하기 위한 값 (FSubsystemCollectionBase::GetChangeSerialNumber) */
+	int32 BuiltForSerialNumber = INDEX_NONE;
+
+private:
+	void TickSubsystem(UWorldSubsystem* Subsystem, EWorldSubsystemTickPhase Phase, float DeltaTime)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Subsystem->GetClass()->GetName());
+        const double StartTime = FPlatformTime::Seconds();
+        Subsystem->TickPhase(Phase, DeltaTime);
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+        // Stats 맵은 Rebuild에서만 변경되므로, 여기서는 서브시스템마다 자기 항목만 갱신한다 (동시에 같은 항목을 쓰지 않음)
+        FWorldSubsystemTickStats& SubsystemStats = Stats.FindChecked(Subsystem);
+        SubsystemStats.LastTickSeconds = Elapsed;
+        SubsystemStats.TotalTickSeconds += Elapsed;
+        SubsystemStats.NumTicks++;
+    }
+
+	struct FWave
+    {
+        TArray<UWorldSubsystem*> ParallelSubsystems;
+        TArray<UWorldSubsystem*> GameThreadSubsystems;
+        TArray<FWorldSubsystemTickAccess> Accesses;
+    };
+
+	TArray<FWave> PhaseWaves[(int32)EWorldSubsystemTickPhase::Num];
+	TMap<const UWorldSubsystem*, FWorldSubsystemTickStats> Stats;
+};
+
+/**
+ * 서브시스템 클래스별 사용 통계. 지연 초기화 모드에서 어떤 서브시스템이 실제로 쓰였는지와 절약한 비용을 보고하는 데 사용한다.
+ * @see FSubsystemCollectionBase::DumpUsageReport
+ */
+struct FSubsystemUsageStats
+{
+    /** 생성(Initialize)된 횟수 */
+	int32 NumCreated = 0;
+
+    /** 지연 초기화로 생성을 미뤘던 횟수 */
+	int32 NumDeferred = 0;
+
+    /** 미뤄둔 서브시스템이 GetSubsystem에 의해 실제로 생성된 횟수 */
+	int32 NumCreatedOnDemand = 0;
+
+    /** 인스턴스 하나의 크기 (UClass::GetStructureSize) */
+	int32 InstanceSizeBytes = 0;
+
+    /** 생성 + Initialize에 걸린 시간의 누적 (평균을 구하는 데 사용) */
+	double TotalInitSeconds = 0.0;
+};
+
+/**
+ * kwakkh : SubsystemCollection.h 에 존재
+ * - 서브시스템들을 클래스별로 생성/보관/파괴하는 컬렉션. UWorld::SubsystemCollection이 FObjectSubsystemCollection<UWorldSubsystem>이다.
+ * - Initialize에서 TBaseType의 모든 자식 클래스들 중 ShouldCreateSubsystem이 true인 것을 전부 생성한다.
+ * 
+ * 지연 초기화(lazy) 모드:
+ * - 프리뷰/비활성 월드처럼 대부분의 서브시스템을 쓰지 않는 월드에서도 모든 서브시스템이 생성/초기화되고 있었다.
+ * - LazyWorldTypeMask에 켠 월드 타입에서만 사용한다. (기본값 0, opt-in)
+ * - 지연 모드에서는 Initialize 시점에 RequiresEagerInitialization()이 true인 것만 생성하고, 나머지는 클래스만 기억해둔다.
+ * - 기억해둔 서브시스템은 처음 GetSubsystem<T>()가 호출될 때 생성 + Initialize 된다.
+ *   - 월드가 이미 지나간 생명 주기 단계(PostInitialize, OnWorldComponentsUpdated, OnWorldBeginPlay)는 생성 직후 순서대로 재생해 준다.
+ *     (eager 서브시스템과 같은 호출 순서를 보게 된다)
+ */
+class FSubsystemCollectionBase
+{
+public:
+    /** UWorld가 서브시스템들에게 알린 생명 주기 단계 (MarkWorldPhaseReached) */
+	enum class EWorldPhase : uint8
+	{
+		PostInitialized		= 1 << 0,	// UWorld::PostInitializeSubsystems
+		ComponentsUpdated	= 1 << 1,	// UWorld::UpdateWorldComponents -> OnWorldComponentsUpdated
+		BegunPlay			= 1 << 2,	// UWorld::BeginPlay -> OnWorldBeginPlay
+	};
+
+    /** 월드가 해당 단계를 모든 서브시스템에게 알린 직후 호출한다. 이후 지연 생성되는 서브시스템에게 같은 호출을 재생한다 */
+	void MarkWorldPhaseReached(EWorldPhase Phase)
+    {
+        ReachedWorldPhases |= (uint8)Phase;
+    }
+
+    /** 컬렉션을 초기화. Outer는 서브시스템들의 Outer가 된다 (UWorldSubsystem의 경우 UWorld) */
+	ENGINE_API void Initialize(UObject* NewOuter)
+    {
+        Outer = NewOuter;
+        bLazyInitialization = ShouldUseLazyInitialization(NewOuter);
+
+        TArray<UClass*> SubsystemClasses;
+        GetDerivedClasses(BaseType, SubsystemClasses, true);
+        for (UClass* SubsystemClass : SubsystemClasses)
+        {
+            if (SubsystemClass->HasAnyClassFlags(CLASS_Abstract))
+            {
+                continue;
+            }
+
+            // 앞서 다른 서브시스템의 InitializeDependency로 이미 만들어졌을 수 있다
+            if (SubsystemMap.Contains(SubsystemClass))
+            {
+                continue;
+            }
+
+            const USubsystem* CDO = SubsystemClass->GetDefaultObject<USubsystem>();
+            if (!CDO->ShouldCreateSubsystem(Outer))
+            {
+                continue;
+            }
+
+            if (bLazyInitialization && !CDO->RequiresEagerInitialization())
+            {
+                DeferredSubsystemClasses.Add(SubsystemClass);
+                GetUsageStats(SubsystemClass).NumDeferred++;
+                continue;
+            }
+
+            AddAndInitializeSubsystem(SubsystemClass);
+        }
+    }
+
+    /** 다른 서브시스템의 Initialize 안에서 호출하여, 의존하는 서브시스템이 먼저 초기화되도록 보장한다 */
+	ENGINE_API USubsystem* InitializeDependency(TSubclassOf<USubsystem> SubsystemClass)
+    {
+        if (USubsystem* const* Existing = SubsystemMap.Find(SubsystemClass))
+        {
+            return *Existing;
+        }
+
+        // 미뤄둔 서브시스템이면 ShouldCreateSubsystem을 이미 통과했다. 지연 생성과 같이 집계한다
+        if (DeferredSubsystemClasses.RemoveSwap(SubsystemClass) > 0)
+        {
+            GetUsageStats(SubsystemClass).NumCreatedOnDemand++;
+            return AddAndInitializeSubsystem(SubsystemClass);
+        }
+
+        // Initialize 루프가 아직 도달하지 않았거나 걸러낸 클래스: Initialize와 같은 조건으로 검사한다
+        if (SubsystemClass->HasAnyClassFlags(CLASS_Abstract) || !SubsystemClass->GetDefaultObject<USubsystem>()->ShouldCreateSubsystem(Outer))
+        {
+            return nullptr;
+        }
+        return AddAndInitializeSubsystem(SubsystemClass);
+    }
+
+    /** 모든 서브시스템을 Deinitialize하고 컬렉션을 비운다. 다시 쓰려면 Initialize를 호출해야 한다 */
+	ENGINE_API void Deinitialize()
+    {
+        check(IsInGameThread());
+        for (const TPair<TObjectPtr<UClass>, TObjectPtr<USubsystem>>& Pair : SubsystemMap)
+        {
+            Pair.Value->Deinitialize();
+            Pair.Value->InternalOwningSubsystem = nullptr;
+        }
+        SubsystemMap.Empty();
+        DeferredSubsystemClasses.Empty();
+        InvalidateTypeIndexCaches();
+        ReachedWorldPhases = 0;
+        Outer = nullptr;
+    }
+
+    /** 서브시스템 하나를 Deinitialize하고 제거한다 (클래스 재인스턴싱 등). 타입 인덱스 캐시도 함께 무효화된다 */
+	ENGINE_API void RemoveAndDeinitializeSubsystem(USubsystem* Subsystem)
+    {
+        check(IsInGameThread());
+        if (SubsystemMap.Remove(Subsystem->GetClass()) > 0)
+        {
+            InvalidateTypeIndexCaches();
+            Subsystem->Deinitialize();
+            Subsystem->InternalOwningSubsystem = nullptr;
+        }
+    }
+
+    /** 
+     * 지연 초기화 모드를 사용할 월드 타입들의 비트 마스크 (1 << EWorldType::Type)
+     * (s.LazyWorldSubsystemWorldTypes 콘솔 변수로 제어, 기본값은 0 == 모든 월드 타입에서 기존처럼 전부 생성)
+     * kwakkh : 아직 RequiresEagerInitialization을 오버라이드한 서브시스템이 없으므로 opt-in이다.
+     *          DumpUsageReport로 해당 월드 타입의 서브시스템들을 확인한 뒤에 켠다
+     */
+	static ENGINE_API int32 LazyWorldTypeMask;
+
+    /** 월드 타입별, 서브시스템 클래스별 사용 통계를 출력. 한 번도 쓰이지 않은 서브시스템과 그로 인해 절약한 메모리/시간을 보여준다 */
+	static ENGINE_API void DumpUsageReport(FOutputDevice& Ar)
+    {
+        for (const TPair<int32, TMap<UClass*, FSubsystemUsageStats>>& WorldTypePair : UsageStatsPerWorldType)
+        {
+            int64 SavedBytes = 0;
+            double SavedSeconds = 0.0;
+
+            Ar.Logf(TEXT("WorldType %d:"), WorldTypePair.Key);
+            for (const TPair<UClass*, FSubsystemUsageStats>& Pair : WorldTypePair.Value)
+            {
+                const FSubsystemUsageStats& Stats = Pair.Value;
+                const int32 NumNeverCreated = Stats.NumDeferred - Stats.NumCreatedOnDemand;
+                const double AverageInitSeconds = Stats.NumCreated > 0 ? Stats.TotalInitSeconds / Stats.NumCreated : 0.0;
+                SavedBytes += (int64)NumNeverCreated * Stats.InstanceSizeBytes;
+                SavedSeconds += NumNeverCreated * AverageInitSeconds;
+
+                Ar.Logf(TEXT("  %s: Created=%d Deferred=%d CreatedOnDemand=%d Unused=%d Size=%d AvgInit=%.3fms"),
+                    *Pair.Key->GetName(), Stats.NumCreated, Stats.NumDeferred, Stats.NumCreatedOnDemand, NumNeverCreated,
+                    Stats.InstanceSizeBytes, AverageInitSeconds * 1000.0);
+            }
+            Ar.Logf(TEXT("  Saved: %lld bytes, %.3fms"), SavedBytes, SavedSeconds * 1000.0);
+        }
+    }
+
+    /** 
+     * 서브시스템이 추가되거나(Initialize, 지연 생성, InitializeDependency) 제거될 때(Deinitialize, RemoveAndDeinitializeSubsystem) 증가하는 값.
+     * 서브시스템 목록으로 무언가를 캐시하는 쪽에서 변경을 감지할 때 사용
+     */
+	int32 GetChangeSerialNumber() const { return ChangeSerialNumber; }
+
+    /** 이미 생성된 서브시스템들을 OutSubsystems에 복사한다. (GetSubsystemArray와 같은 내용이지만 캐시를 거치지 않아 어느 스레드에서나 쓸 수 있다) */
+	template <typename TSubsystemClass>
+	void GetCreatedSubsystems(TArray<TSubsystemClass*>& OutSubsystems) const
+    {
+        OutSubsystems.Reset(SubsystemMap.Num());
+        for (const TPair<TObjectPtr<UClass>, TObjectPtr<USubsystem>>& Pair : SubsystemMap)
+        {
+            if (TSubsystemClass* Subsystem = Cast<TSubsystemClass>(Pair.Value))
+            {
+                OutSubsystems.Add(Subsystem);
+            }
+        }
+    }
+
+    /** 미뤄둔 서브시스템이 남아 있는지 여부 */
+	bool HasDeferredSubsystems() const { return DeferredSubsystemClasses.Num() > 0; }
+
+    /** 미뤄둔 서브시스템들을 모두 생성한다 (게임 스레드 전용) */
+	void CreateAllDeferredSubsystems()
+    {
+        while (DeferredSubsystemClasses.Num() > 0)
+        {
+            CreateDeferredSubsystem(DeferredSubsystemClasses.Last());
+        }
+    }
+
+    /** 
+     * 서브시스템 타입마다 한 번씩 호출되어 고유한 타입 인덱스를 발급한다. (see TSubsystemTypeIndex)
+     * SubsystemCollection.cpp에 정의된 카운터를 쓴다. (헤더의 inline static이면 모듈(DLL)마다 카운터가 따로 생겨 인덱스가 겹친다)
+     */
+	static ENGINE_API int32 AllocateTypeIndex();
+
+    /** 타입 인덱스 캐시의 크기. 이보다 큰 인덱스를 받은 타입은 캐시 없이 클래스로 찾는다 */
+	static constexpr int32 MaxCachedTypeIndices = 1024;
+
+protected:
+	ENGINE_API FSubsystemCollectionBase(UClass* InBaseType)
+        : SubsystemsByTypeIndex(MakeUnique<std::atomic<USubsystem*>[]>(MaxCachedTypeIndices))
+        , BaseType(InBaseType)
+    {
+    }
+
+    /** 
+     * 타입 인덱스로 캐시된 서브시스템을 찾는다. 캐시에 없으면 클래스로 찾은 뒤(필요하면 지연 생성) 캐시에 넣는다.
+     * kwakkh
+     * - 캐시가 채워진 뒤에는 배열 로드 한 번이다. 없는 서브시스템(nullptr)도 MissingSubsystem으로 캐시한다.
+     * - 캐시는 처음부터 고정 크기로 잡혀 있어 재할당되지 않는다. 쓰기는 게임 스레드에서만 하고, 다른 스레드는 읽기만 한다.
+     *   (워커 스레드에서 캐시에 없으면 캐시를 채우지 않고 클래스로 찾는다)
+     */
+	FORCEINLINE USubsystem* GetSubsystemByTypeIndex(int32 TypeIndex, UClass* SubsystemClass) const
+    {
+        if (TypeIndex < MaxCachedTypeIndices)
+        {
+            USubsystem* Cached = SubsystemsByTypeIndex[TypeIndex].load(std::memory_order_acquire);
+            if (Cached)
+            {
+                return Cached != MissingSubsystem() ? Cached : nullptr;
+            }
+        }
+        return CacheSubsystemByTypeIndex(TypeIndex, SubsystemClass);
+    }
+
+    /** 
+     * 타입 인덱스로 캐시된, SubsystemClass의 인스턴스인 (이미 생성된) 모든 서브시스템 배열을 반환. 처음 한 번만 만들고 이후에는 할당 없이 반환한다
+     * 미뤄둔 서브시스템은 생성하지 않는다. 나중에 생성되면 InvalidateTypeIndexCaches로 배열이 다시 만들어진다.
+     * 반환하는 배열을 캐시가 소유하므로 게임 스레드에서만 호출해야 한다.
+     */
+	const TArray<USubsystem*>& GetSubsystemArrayByTypeIndex(int32 TypeIndex, UClass* SubsystemClass) const
+    {
+        check(IsInGameThread());
+        if (SubsystemArraysByTypeIndex.IsValidIndex(TypeIndex) && SubsystemArraysByTypeIndex[TypeIndex].bIsValid)
+        {
+            return SubsystemArraysByTypeIndex[TypeIndex].Subsystems;
+        }
+        return CacheSubsystemArrayByTypeIndex(TypeIndex, SubsystemClass);
+    }
+
+    /** 
+     * 클래스로 서브시스템을 찾는다. 지연 모드에서 아직 생성되지 않은 서브시스템이면 이때 생성한다.
+     * kwakkh : GetSubsystem은 const 함수지만, 지연 생성은 "이미 있었어야 할 것을 지금 만드는 것"이므로 논리적으로는 상태 변경이 아니다.
+     */
+	ENGINE_API USubsystem* GetSubsystemInternal(UClass* SubsystemClass) const
+    {
+        if (USubsystem* const* Existing = SubsystemMap.Find(SubsystemClass))
+        {
+            return *Existing;
+        }
+
+        // 지연 생성은 게임 스레드에서만 한다. 병렬 틱 단계는 시작 전에 미뤄둔 서브시스템을 모두 만들어 두므로 여기까지 오지 않는다
+        if (DeferredSubsystemClasses.Num() > 0 && IsInGameThread())
+        {
+            return const_cast<FSubsystemCollectionBase*>(this)->CreateDeferredSubsystem(SubsystemClass);
+        }
+        return nullptr;
+    }
+
+private:
+    /** 캐시에 "찾아봤지만 없음"을 나타내는 값. 유효한 UObject 주소가 될 수 없다 */
+	static USubsystem* MissingSubsystem() { return reinterpret_cast<USubsystem*>(1); }
+
+	USubsystem* CacheSubsystemByTypeIndex(int32 TypeIndex, UClass* SubsystemClass) const
+    {
+        USubsystem* Subsystem = GetSubsystemInternal(SubsystemClass);
+        if (TypeIndex < MaxCachedTypeIndices && IsInGameThread())
+        {
+            // 미뤄둔 서브시스템이 남아 있으면 나중에 생길 수 있으므로 "없음"은 캐시하지 않는다 (생성되면 InvalidateTypeIndexCaches)
+            if (Subsystem || DeferredSubsystemClasses.Num() == 0)
+            {
+                if (SubsystemsByTypeIndex[TypeIndex].exchange(Subsystem ? Subsystem : MissingSubsystem(), std::memory_order_acq_rel) == nullptr)
+                {
+                    FilledTypeIndices.Add(TypeIndex);
+                }
+            }
+        }
+        return Subsystem;
+    }
+
+	const TArray<USubsystem*>& CacheSubsystemArrayByTypeIndex(int32 TypeIndex, UClass* SubsystemClass) const
+    {
+        if (SubsystemArraysByTypeIndex.Num() <= TypeIndex)
+        {
+            SubsystemArraysByTypeIndex.SetNum(TypeIndex + 1);
+        }
+
+        FCachedSubsystemArray& Cached = SubsystemArraysByTypeIndex[TypeIndex];
+        Cached.Subsystems.Reset();
+        for (const TPair<TObjectPtr<UClass>, TObjectPtr<USubsystem>>& Pair : SubsystemMap)
+        {
+            if (Pair.Key->IsChildOf(SubsystemClass))
+            {
+                Cached.Subsystems.Add(Pair.Value);
+            }
+        }
+        Cached.bIsValid = true;
+        return Cached.Subsystems;
+    }
+
+    /** 
+     * 서브시스템이 추가/제거되면 타입 인덱스 캐시들을 비운다 (다음 조회에서 다시 채워진다)
+     * kwakkh : 지연 생성 때마다 불리므로 MaxCachedTypeIndices 전체가 아니라 채워진 칸(FilledTypeIndices)만 비운다
+     */
+	void InvalidateTypeIndexCaches()
+    {
+        check(IsInGameThread());
+        ++ChangeSerialNumber;
+        for (const int32 TypeIndex : FilledTypeIndices)
+        {
+            SubsystemsByTypeIndex[TypeIndex].store(nullptr, std::memory_order_relaxed);
+        }
+        FilledTypeIndices.Reset();
+        for (FCachedSubsystemArray& Cached : SubsystemArraysByTypeIndex)
+        {
+            Cached.bIsValid = false;
+        }
+    }
+
+    /** SubsystemClass 자신 또는 그 자식 클래스 중 미뤄둔 것이 있으면 생성한다 (GetSubsystem<부모클래스>()로 찾는 경우) */
+	USubsystem* CreateDeferredSubsystem(UClass* SubsystemClass)
+    {
+        check(IsInGameThread());
+        for (int32 Index = 0; Index < DeferredSubsystemClasses.Num(); ++Index)
+        {
+            UClass* DeferredClass = DeferredSubsystemClasses[Index];
+            if (DeferredClass->IsChildOf(SubsystemClass))
+            {
+                DeferredSubsystemClasses.RemoveAtSwap(Index);
+                GetUsageStats(DeferredClass).NumCreatedOnDemand++;
+                return AddAndInitializeSubsystem(DeferredClass);
+            }
+        }
+        return nullptr;
+    }
+
+	USubsystem* AddAndInitializeSubsystem(UClass* SubsystemClass)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        USubsystem* Subsystem = NewObject<USubsystem>(Outer, SubsystemClass);
+        SubsystemMap.Add(SubsystemClass, Subsystem);
+        InvalidateTypeIndexCaches();
+        Subsystem->InternalOwningSubsystem = this;
+        Subsystem->Initialize(*this);
+        ReplayWorldPhases(Subsystem);
+
+        FSubsystemUsageStats& Stats = GetUsageStats(SubsystemClass);
+        Stats.NumCreated++;
+        Stats.InstanceSizeBytes = SubsystemClass->GetStructureSize();
+        Stats.TotalInitSeconds += FPlatformTime::Seconds() - StartTime;
+        return Subsystem;
+    }
+
+    /** 월드가 이미 지나간 단계의 호출을 새로 만든 서브시스템에게 순서대로 재생한다 */
+	void ReplayWorldPhases(USubsystem* Subsystem)
+    {
+        UWorldSubsystem* WorldSubsystem = Cast<UWorldSubsystem>(Subsystem);
+        if (!WorldSubsystem || ReachedWorldPhases == 0)
+        {
+            return;
+        }
+
+        UWorld& World = *CastChecked<UWorld>(Outer);
+        if (ReachedWorldPhases & (uint8)EWorldPhase::PostInitialized)
+        {
+            WorldSubsystem->PostInitialize();
+        }
+        if (ReachedWorldPhases & (uint8)EWorldPhase::ComponentsUpdated)
+        {
+            WorldSubsystem->OnWorldComponentsUpdated(World);
+        }
+        if (ReachedWorldPhases & (uint8)EWorldPhase::BegunPlay)
+        {
+            WorldSubsystem->OnWorldBeginPlay(World);
+        }
+    }
+
+	bool ShouldUseLazyInitialization(UObject* InOuter) const
+    {
+        const UWorld* World = Cast<UWorld>(InOuter);
+        return World && (LazyWorldTypeMask & (1 << World->WorldType)) != 0;
+    }
+
+	FSubsystemUsageStats& GetUsageStats(UClass* SubsystemClass) const
+    {
+        const UWorld* World = Cast<UWorld>(Outer);
+        const int32 WorldType = World ? (int32)World->WorldType : -1;
+        return UsageStatsPerWorldType.FindOrAdd(WorldType).FindOrAdd(SubsystemClass);
+    }
+
+    /** 생성된 서브시스템들 (클래스 -> 인스턴스) */
+	TMap<TObjectPtr<UClass>, TObjectPtr<USubsystem>> SubsystemMap;
+
+    /** 타입 인덱스 -> 서브시스템 (nullptr: 아직 찾아보지 않음, MissingSubsystem: 없음). GetSubsystem<T>()의 빠른 경로. 고정 크기 MaxCachedTypeIndices */
+	TUniquePtr<std::atomic<USubsystem*>[]> SubsystemsByTypeIndex;
+
+    /** SubsystemsByTypeIndex에서 nullptr이 아닌 칸들의 인덱스 (게임 스레드 전용) */
+	mutable TArray<int32> FilledTypeIndices;
+
+    struct FCachedSubsystemArray
+    {
+        TArray<USubsystem*> Subsystems;
+        bool bIsValid = false;
+    };
+
+    /** 타입 인덱스 -> 해당 타입의 서브시스템 배열. GetSubsystemArray<T>()의 빠른 경로 (게임 스레드 전용) */
+	mutable TArray<FCachedSubsystemArray> SubsystemArraysByTypeIndex;
+
+    /** 지연 모드에서 생성을 미뤄둔 서브시스템 클래스들 */
+	TArray<UClass*> DeferredSubsystemClasses;
+
+	UClass* BaseType;
+	UObject* Outer = nullptr;
+	int32 ChangeSerialNumber = 0;
+	bool bLazyInitialization = false;
+
+    /** EWorldPhase 비트 마스크 */
+	uint8 ReachedWorldPhases = 0;
+
+    /** 월드 타입 -> 서브시스템 클래스 -> 사용 통계 (게임 스레드 전용) */
+	static ENGINE_API TMap<int32, TMap<UClass*, FSubsystemUsageStats>> UsageStatsPerWorldType;
+};
+
+/**
+ * 서브시스템 타입 T마다 하나씩 발급되는 인덱스. 타입별로 처음 사용될 때 한 번 발급되고 이후에는 상수처럼 쓰인다.
+ * 
+ * kwakkh
+ * - 진짜 컴파일 타임 상수로 만들려면 모든 서브시스템 타입을 한 곳에서 알아야 하는데, 모듈(DLL)마다 서브시스템이 흩어져 있어 불가능하다.
+ * - 대신 함수 로컬 static으로 "처음 한 번만" 발급한다. (스레드 안전한 초기화 이후에는 일반 전역 변수 로드와 같다)
+ * - 모듈마다 같은 T에 대해 다른 인덱스를 받을 수도 있지만, 카운터는 하나(AllocateTypeIndex)라서 다른 타입과 겹치지 않고 각각이 같은 서브시스템을 캐시하므로 결과는 같다.
+ */
+template<typename T>
+struct TSubsystemTypeIndex
+{
+	static int32 Get()
+    {
+        static const int32 Index = FSubsystemCollectionBase::AllocateTypeIndex();
+        return Index;
+    }
+};
+
+template<typename TBaseType>
+class FObjectSubsystemCollection : public FSubsystemCollectionBase
+{
+public:
+	FObjectSubsystemCollection() : FSubsystemCollectionBase(TBaseType::StaticClass()) {}
+
+    /** 
+     * 타입으로 서브시스템을 찾는다. 첫 조회 이후에는 타입 인덱스로 배열을 바로 읽는다.
+     * (게임플레이 코드에서 매 프레임 호출하는 경우 GetSubsystem(TSubclassOf)보다 이쪽을 사용)
+     */
+	template <typename TSubsystemClass>
+	FORCEINLINE TSubsystemClass* GetSubsystem() const
+    {
+        static_assert(TIsDerivedFrom<TSubsystemClass, TBaseType>::IsDerived, "TSubsystemClass must be derived from TBaseType");
+        return static_cast<TSubsystemClass*>(GetSubsystemByTypeIndex(TSubsystemTypeIndex<TSubsystemClass>::Get(), TSubsystemClass::StaticClass()));
+    }
+
+    /** 
+     * TSubsystemClass(여러 구현체를 가진 추상 서브시스템 클래스)의 인스턴스인 모든 서브시스템을 반환. 
+     * 배열은 처음 한 번 만들어져 캐시되며, 이후 호출은 할당 없이 연속된 배열을 그대로 돌려준다.
+     * 서브시스템이 추가/제거되면 무효화되므로 반환값을 보관하지 말 것.
+     */
+	template <typename TSubsystemClass>
+	TArrayView<TSubsystemClass* const> GetSubsystemArray() const
+    {
+        const TArray<USubsystem*>& Subsystems = GetSubsystemArrayByTypeIndex(TSubsystemTypeIndex<TSubsystemClass>::Get(), TSubsystemClass::StaticClass());
+        return TArrayView<TSubsystemClass* const>(reinterpret_cast<TSubsystemClass* const*>(Subsystems.GetData()), Subsystems.Num());
+    }
+
+    /** 클래스로 서브시스템을 찾는다. 지연 모드라면 처음 호출될 때 생성된다 */
+	template <typename TSubsystemClass>
+	TSubsystemClass* GetSubsystem(const TSubclassOf<TSubsystemClass>& SubsystemClass) const
+    {
+        static_assert(TIsDerivedFrom<TSubsystemClass, TBaseType>::IsDerived, "TSubsystemClass must be derived from TBaseType");
+        return static_cast<TSubsystemClass*>(GetSubsystemInternal(SubsystemClass));
+    }
+};
+
 /** 
  * Indicates the type of a level collection, used in FLevelCollection.
  * 20 - Foundation - CreateWorld - ELevelCollectionType
@@ -176,6 +905,68 @@ struct FLevelCollection
 	TSet<TObjectPtr<ULevel>> Levels;
 }
 
+/** FWorldPool이 (EWorldType, 초기화 값) 키마다 보관하는 최대 월드 수 (s.WorldPool.MaxWorldsPerKey, 0이면 비활성) */
+extern ENGINE_API int32 GWorldPoolMaxWorldsPerKey;
+
+/**
+ * 재사용을 위해 리셋된 월드들을 (EWorldType, FWorldInitializationValues)별로 보관하는 풀.
+ * @see UWorld::CreatePooledWorld, UWorld::ReleasePooledWorld
+ * 
+ * kwakkh
+ * - 풀에 들어 있는 월드는 AddToRoot 된 상태로 유지되어 GC 되지 않는다.
+ * - 키마다 최대 GWorldPoolMaxWorldsPerKey개까지만 보관한다. (0이면 풀을 사용하지 않음)
+ */
+struct FWorldPool
+{
+    static FWorldPool& Get()
+    {
+        static FWorldPool Instance;
+        return Instance;
+    }
+
+    /** UWorld를 역참조하지 않는다 (UWorld 선언 전에 정의됨) */
+    UWorld* Acquire(EWorldType::Type WorldType, const FWorldInitializationValues& IVS)
+    {
+        check(IsInGameThread());
+        if (TArray<UWorld*>* Worlds = PooledWorlds.Find(FKey(WorldType, IVS)))
+        {
+            if (Worlds->Num() > 0)
+            {
+                ++NumHits;
+                return Worlds->Pop(EAllowShrinking::No);
+            }
+        }
+        ++NumMisses;
+        return nullptr;
+    }
+
+    /** World를 지금 되돌려 놓으면 보관할 자리가 있는지. (GWorldPoolMaxWorldsPerKey가 0이면 항상 false) */
+    bool HasRoomFor(const UWorld* World) const;
+
+    /** @return 풀에 보관했으면 true, 풀이 가득 차서 보관하지 못했으면 false */
+    bool Release(UWorld* World);
+
+    /** 보관 중인 모든 월드를 파괴 (엔진 종료 시 UEngine::PreExit에서 호출) */
+    void Empty();
+
+    int32 NumHits = 0;
+    int32 NumMisses = 0;
+
+private:
+    struct FKey
+    {
+        FKey(EWorldType::Type InWorldType, const FWorldInitializationValues& InIVS) : WorldType(InWorldType), IVS(InIVS) {}
+
+        EWorldType::Type WorldType;
+        FWorldInitializationValues IVS;
+
+        bool operator==(const FKey& Other) const { return WorldType == Other.WorldType && IVS.IsEquivalentForPooling(Other.IVS); }
+        friend uint32 GetTypeHash(const FKey& Key) { return HashCombine(GetTypeHash((uint8)Key.WorldType), Key.IVS.GetPoolingHash()); }
+    };
+
+    TMap<FKey, TArray<UWorld*>> PooledWorlds;
+};
+
 /** 
  * **월드(World)**는 액터(Actor)와 컴포넌트(Component)들이 존재하며 렌더링되는 맵 또는 샌드박스(Sandbox)를 나타내는 최상위 객체
  * 
@@ -286,6 +1077,322 @@ class UWorld final : public UObject, public FNetworkNotify
         return NewWorld;
     }
 
+    /**
+     * FWorldPool에서 재사용 가능한 월드를 꺼내거나, 없으면 CreateWorld로 새로 만든다.
+     * 풀에서 꺼낸 월드는 ReleasePooledWorld로 되돌려 놓기 전까지는 일반 월드와 똑같이 사용하면 된다.
+     * 
+     * kwakkh
+     * - CreateWorld는 매번 UPackage 생성 -> NewObject<UWorld> -> InitializeNewWorld(물리 씬, 내비게이션, AI 등)를 거친다.
+     * - 수명이 짧은 GamePreview/GameRPC 월드를 자주 만들고 버리는 서버에서는 이 비용이 대부분이다.
+     * - 다 쓴 월드를 파괴하지 않고 리셋해서 다음 요청에 돌려주면, 무거운 초기화는 처음 한 번만 한다.
+     */
+	static UE_API UWorld* CreatePooledWorld(const EWorldType::Type InWorldType, const InitializationValues& IVS, FName WorldName = NAME_None)
+    {
+        if (UWorld* PooledWorld = FWorldPool::Get().Acquire(InWorldType, IVS))
+        {
+            // kwakkh : 이전 세션의 패키지/이름을 물려받지 않도록 CreateWorld와 같은 규칙으로 새 패키지로 옮긴다
+            // - 새 패키지 생성은 InitializeNewWorld에 비하면 무시할 만한 비용이고, 비게 된 이전 패키지는 GC가 수거한다
+            UPackage* WorldPackage = CreatePackage(nullptr);
+            if (InWorldType == EWorldType::PIE)
+            {
+                WorldPackage->SetPackageFlags(PKG_PlayInEditor);
+            }
+            WorldPackage->ThisContainsMap();
+
+            const FString WorldNameString = (WorldName != NAME_None) ? WorldName.ToString() : TEXT("Untitled");
+            PooledWorld->Rename(*WorldNameString, WorldPackage, REN_DontCreateRedirectors | REN_NonTransactional);
+            WorldPackage->SetDirtyFlag(false);
+
+            // kwakkh : 바깥에서 보면 새 월드가 만들어지고 초기화된 것이므로, CreateWorld -> InitWorld와 같은 델리게이트를 보낸다
+            FWorldDelegates::OnPostWorldCreation.Broadcast(PooledWorld);
+            FWorldDelegates::OnPostWorldInitialization.Broadcast(PooledWorld, IVS);
+            return PooledWorld;
+        }
+
+        UWorld* NewWorld = CreateWorld(InWorldType, false, WorldName, nullptr, true, ERHIFeatureLevel::Num, &IVS);
+        NewWorld->PoolingValues = IVS;
+        return NewWorld;
+    }
+
+    /** 
+     * CreatePooledWorld로 얻은 월드를 풀에 되돌려 놓는다. 
+     * 풀이 가득 찼으면 (또는 풀을 사용하지 않으면) 리셋하지 않고 일반 월드처럼 바로 파괴한다.
+     */
+	static UE_API void ReleasePooledWorld(UWorld* World)
+    {
+        FWorldPool& Pool = FWorldPool::Get();
+        if (!Pool.HasRoomFor(World))
+        {
+            World->DestroyWorld(false);
+            World->RemoveFromRoot();
+            return;
+        }
+
+        World->ResetForReuse();
+        verify(Pool.Release(World));
+    }
+
+    /** 
+     * 월드를 막 생성된 상태로 되돌린다. UWorld 객체, 패키지 밖의 할당(영구 레벨, WorldSettings 등)은 유지하고
+     * 세션 상태를 들고 있는 것들은 InitializeNewWorld와 같은 설정으로 다시 만든다.
+     * - 스폰된 액터 파괴, 스트리밍 레벨 제거, 넷 드라이버 종료, 타이머/잠복(latent) 액션 초기화
+     * - 내비게이션, AI 시스템, 물리 씬 재생성 (이전 세션의 내비 데이터, 블랙보드, 물리 바디가 남지 않도록)
+     * - 서브시스템 Deinitialize -> Initialize 한 번
+     * - 시간/플레이 상태 초기화
+     * kwakkh : 바깥에서 보면 월드가 정리(CleanupWorld)되는 것이므로, 해제 단계 앞뒤로 OnWorldCleanup / OnPostWorldCleanup을 보낸다
+     */
+	void ResetForReuse()
+    {
+        check(IsInGameThread());
+        if (bBegunPlay)
+        {
+            EndPlay(EEndPlayReason::RemovedFromWorld);
+        }
+
+        FWorldDelegates::OnWorldCleanup.Broadcast(this, true, true);
+
+        if (GEngine)
+        {
+            GEngine->ShutdownWorldNetDriver(this);
+        }
+
+        // 영구 레벨에 새로 스폰된 액터들만 제거 (InitializeNewWorld가 만든 WorldSettings, 기본 물리 볼륨 등은 유지)
+        for (int32 ActorIndex = PersistentLevel->Actors.Num() - 1; ActorIndex >= 0; --ActorIndex)
+        {
+            AActor* Actor = PersistentLevel->Actors[ActorIndex];
+            if (Actor && Actor != PersistentLevel->GetWorldSettings() && Actor != DefaultPhysicsVolume)
+            {
+                DestroyActor(Actor);
+            }
+        }
+
+        // 스트리밍으로 추가된 레벨들 제거
+        for (int32 LevelIndex = Levels.Num() - 1; LevelIndex >= 0; --LevelIndex)
+        {
+            if (Levels[LevelIndex] != PersistentLevel)
+            {
+                RemoveFromWorld(Levels[LevelIndex]);
+            }
+        }
+        ClearStreamingLevels();
+
+        // 이전 세션이 걸어둔 타이머 / 잠복 액션
+        delete TimerManager;
+        TimerManager = new FTimerManager();
+        LatentActionManager = FLatentActionManager();
+
+        // 서브시스템은 Deinitialize에서 아직 살아 있는 내비게이션/AI를 참조할 수 있으므로 먼저 내린다
+        SubsystemCollection.Deinitialize();
+
+        if (AISystem)
+        {
+            AISystem->CleanupWorld(true, true);
+            AISystem = nullptr;
+        }
+        if (NavigationSystem)
+        {
+            NavigationSystem->CleanUp(FNavigationSystem::ECleanupMode::CleanupUnsafe);
+            SetNavigationSystem(nullptr);
+        }
+
+        // 물리 씬: 남은 컴포넌트들(WorldSettings, 기본 물리 볼륨 등)의 물리 상태를 내렸다가 새 씬에 다시 올린다
+        if (PhysicsScene)
+        {
+            ClearWorldComponents();
+            CreatePhysicsScene(PersistentLevel->GetWorldSettings());
+            UpdateWorldComponents(false, false);
+        }
+
+        FWorldDelegates::OnPostWorldCleanup.Broadcast(this, true, true);
+
+        if (PoolingValues.bCreateNavigation)
+        {
+            FNavigationSystem::AddNavigationSystemToWorld(*this, FNavigationSystemRunMode::InvalidMode);
+        }
+        if (PoolingValues.bCreateAISystem)
+        {
+            CreateAISystem();
+        }
+
+        SubsystemCollection.Initialize(this);
+        PostInitializeSubsystems();
+
+        //...
+
+        TimeSeconds = 0.0;
+        RealTimeSeconds = 0.0;
+        bBegunPlay = false;
+    }
+
+    /**
+     * InitializeNewWorld에서 서로 독립적인 초기화 단계들을 의존성 그래프로 실행한다.
+     * 게임 스레드 밖에서 실행해도 안전한 단계(물리 씬 객체 생성)는 태스크로 띄우고, 
+     * UObject를 생성하는 단계들(내비게이션, AI, 라인 배치기, 서브시스템)은 그동안 게임 스레드에서 의존성 순서대로 실행한다.
+     * 모든 단계가 끝난 뒤에 반환하며, 단계별 소요 시간은 InitStageTimings에 남는다. (InitWorld에서 호출)
+     * 
+     * 물리 씬은 태스크에서 FPhysScene 객체만 만들고, 월드에 연결하는 SetPhysicsScene(SetOwningWorld + FPhysicsDelegates::OnPhysSceneInit 브로드캐스트)은
+     * 서브시스템 단계 직전에 게임 스레드에서 한다. 델리게이트 바인딩 쪽은 지금처럼 게임 스레드에서 호출된다고 가정할 수 있다.
+     * 
+     * kwakkh
+     * - 예전에는 물리 씬 -> 내비게이션 -> AI -> 라인 배치기 -> 서브시스템 순서로 하나씩 만들었다.
+     * - 실제로 순서가 필요한 곳은 (내비게이션 -> AI), (모든 것 -> 서브시스템) 뿐이다.
+     * 
+     *  Diagram:
+     *    [Task]       PhysicsScene ───────────────────────┐
+     *    [GameThread] Navigation ──► AISystem ──► LineBatchers ──► (join) ──► Subsystems
+     */
+	void InitializeWorldStages(const InitializationValues& IVS)
+    {
+        check(IsInGameThread());
+        struct FStageDesc
+        {
+            EWorldInitStage Stage;
+            bool bGameThreadOnly;
+            TArray<EWorldInitStage, TInlineAllocator<4>> Prerequisites;
+            TFunction<void()> Work;
+        };
+
+        TArray<FStageDesc, TInlineAllocator<(int32)EWorldInitStage::Num>> Stages;
+
+        // WorldSettings는 게임 스레드에서 미리 읽어 둔다 (InitializeNewWorld가 InitWorld 전에 스폰해 둔 상태)
+        const AWorldSettings* WorldSettings = GetWorldSettings();
+        FPhysScene* NewPhysicsScene = nullptr;
+        if (IVS.bInitializeScenes && IVS.bCreatePhysicsScene)
+        {
+            Stages.Add({ EWorldInitStage::PhysicsScene, false, {}, [WorldSettings, &NewPhysicsScene]() { NewPhysicsScene = new FPhysScene(WorldSettings); } });
+        }
+        if (IVS.bCreateNavigation)
+        {
+            Stages.Add({ EWorldInitStage::Navigation, true, {}, [this]() { FNavigationSystem::AddNavigationSystemToWorld(*this, FNavigationSystemRunMode::InvalidMode); } });
+        }
+        if (IVS.bCreateAISystem)
+        {
+            Stages.Add({ EWorldInitStage::AISystem, true, { EWorldInitStage::Navigation }, [this]() { CreateAISystem(); } });
+        }
+        Stages.Add({ EWorldInitStage::LineBatchers, true, {}, [this]() { CreateLineBatcherComponents(); } });
+        Stages.Add({ EWorldInitStage::Subsystems, true, { EWorldInitStage::PhysicsScene, EWorldInitStage::Navigation, EWorldInitStage::AISystem, EWorldInitStage::LineBatchers },
+            [this, &NewPhysicsScene]()
+            {
+                // PhysicsScene 단계가 끝난 뒤(선행 조건)이므로 여기서 게임 스레드로 넘겨받아 연결한다
+                if (NewPhysicsScene)
+                {
+                    SetPhysicsScene(NewPhysicsScene);
+                }
+                SubsystemCollection.Initialize(this);
+            } });
+
+        const double InitStartTime = FPlatformTime::Seconds();
+        for (FWorldInitStageTiming& Timing : InitStageTimings)
+        {
+            Timing = FWorldInitStageTiming();
+        }
+
+        auto RunStage = [this, InitStartTime](const FStageDesc& Desc)
+        {
+            FWorldInitStageTiming& Timing = InitStageTimings[(int32)Desc.Stage];
+            Timing.StartSeconds = FPlatformTime::Seconds() - InitStartTime;
+            Desc.Work();
+            Timing.EndSeconds = FPlatformTime::Seconds() - InitStartTime;
+            Timing.bRan = true;
+            Timing.bRanOnGameThread = IsInGameThread();
+        };
+
+        // 단계마다 "완료" 이벤트를 하나씩 둔다. 생략된 단계의 이벤트는 바로 트리거해서 의존하는 쪽이 기다리지 않게 한다.
+        TArray<UE::Tasks::FTaskEvent, TInlineAllocator<(int32)EWorldInitStage::Num>> StageDone;
+        for (int32 StageIndex = 0; StageIndex < (int32)EWorldInitStage::Num; ++StageIndex)
+        {
+            StageDone.Emplace(UE_SOURCE_LOCATION);
+        }
+        for (int32 StageIndex = 0; StageIndex < (int32)EWorldInitStage::Num; ++StageIndex)
+        {
+            if (!Stages.ContainsByPredicate([StageIndex](const FStageDesc& Desc) { return (int32)Desc.Stage == StageIndex; }))
+            {
+                StageDone[StageIndex].Trigger();
+            }
+        }
+
+        // 백그라운드 단계들을 먼저 띄운다
+        for (const FStageDesc& Desc : Stages)
+        {
+            if (!Desc.bGameThreadOnly)
+            {
+                TArray<UE::Tasks::FTaskEvent, TInlineAllocator<4>> Prerequisites;
+                for (EWorldInitStage Prerequisite : Desc.Prerequisites)
+                {
+                    Prerequisites.Add(StageDone[(int32)Prerequisite]);
+                }
+                UE::Tasks::FTaskEvent& Done = StageDone[(int32)Desc.Stage];
+                UE::Tasks::Launch(UE_SOURCE_LOCATION, [&RunStage, &Desc, Done]() mutable { RunStage(Desc); Done.Trigger(); }, UE::Tasks::Prerequisites(Prerequisites));
+            }
+        }
+
+        // 게임 스레드 단계들은 추가된 순서(== 의존성 순서)대로 실행한다. 백그라운드 단계에 의존하면 그 단계를 기다린다.
+        for (const FStageDesc& Desc : Stages)
+        {
+            if (Desc.bGameThreadOnly)
+            {
+                for (EWorldInitStage Prerequisite : Desc.Prerequisites)
+                {
+                    StageDone[(int32)Prerequisite].Wait();
+                }
+                RunStage(Desc);
+                StageDone[(int32)Desc.Stage].Trigger();
+            }
+        }
+
+        // 모든 단계가 끝나기 전에는 반환하지 않는다 (RunStage, Stages가 스택에 있으므로)
+        for (UE::Tasks::FTaskEvent& Done : StageDone)
+        {
+            Done.Wait();
+        }
+
+        UE_LOG(LogWorld, Verbose, TEXT("InitializeNewWorld %s: %.2fms total"), *GetName(), (FPlatformTime::Seconds() - InitStartTime) * 1000.0);
+        for (int32 StageIndex = 0; StageIndex < (int32)EWorldInitStage::Num; ++StageIndex)
+        {
+            const FWorldInitStageTiming& Timing = InitStageTimings[StageIndex];
+            if (Timing.bRan)
+            {
+                UE_LOG(LogWorld, Verbose, TEXT("  Stage %d: %.2fms (start %.2fms, %s)"), StageIndex,
+                    (Timing.EndSeconds - Timing.StartSeconds) * 1000.0, Timing.StartSeconds * 1000.0, Timing.bRanOnGameThread ? TEXT("GameThread") : TEXT("Task"));
+            }
+        }
+    }
+
+    /** 생성된 월드 서브시스템들의 PostInitialize를 호출한다 */
+	void PostInitializeSubsystems()
+    {
+        //... (SubsystemCollection.ForEachSubsystem -> PostInitialize)
+        SubsystemCollection.MarkWorldPhaseReached(FSubsystemCollectionBase::EWorldPhase::PostInitialized);
+    }
+
+    /** Updates world components like e.g. line batcher and all level components. */
+	ENGINE_API void UpdateWorldComponents(bool bRerunConstructionScripts, bool bCurrentLevelOnly, FRegisterComponentContext* Context = nullptr)
+    {
+        //... (레벨 컴포넌트 갱신 후 SubsystemCollection.ForEachSubsystem -> OnWorldComponentsUpdated)
+        SubsystemCollection.MarkWorldPhaseReached(FSubsystemCollectionBase::EWorldPhase::ComponentsUpdated);
+    }
+
+    /** Start gameplay. This will cause the game mode to transition to the correct state and call BeginPlay on all actors */
+	ENGINE_API void BeginPlay()
+    {
+        //... (SubsystemCollection.ForEachSubsystem -> OnWorldBeginPlay)
+        SubsystemCollection.MarkWorldPhaseReached(FSubsystemCollectionBase::EWorldPhase::BegunPlay);
+        //...
+    }
+
+    /**
+     * Initializes the world, associates the persistent level and sets the proper zones.
+     * kwakkh : 물리 씬 / 내비게이션 / AI / 라인 배치기 / 서브시스템을 하나씩 만들던 부분을 InitializeWorldStages로 대신한다
+     */
+	UE_API void InitWorld(const FWorldInitializationValues IVS = FWorldInitializationValues())
+    {
+        //...
+        InitializeWorldStages(IVS);
+        //...
+        PostInitializeSubsystems();
+        //...
+    }
+
     // 9 - Foundation - CreateWorld - UWorld's member variables
 
     /** 
@@ -336,10 +1443,113 @@ class UWorld final : public UObject, public FNetworkNotify
      */
 	FPhysScene*	PhysicsScene;
 
+    /** 마지막 InitializeWorldStages의 단계별 소요 시간 (EWorldInitStage 인덱스) */
+	FWorldInitStageTiming InitStageTimings[(int32)EWorldInitStage::Num];
+
+    /** CreatePooledWorld로 만들어진 경우, 이 월드를 만들 때 사용한 초기화 값 (FWorldPool의 키) */
+	InitializationValues PoolingValues;
+
+    /** 이 월드에 등록된 SceneComponent들의 평평한 트랜스폼 계층 구조 (GFlatTransformHierarchy). USceneComponent::UpdateComponentToWorld가 dirty로 표시하고, Tick / SendAllEndOfFrameUpdates에서 모아서 갱신한다 (see FSceneTransformHierarchy::Flush) */
+	FSceneTransformHierarchy TransformHierarchy;
+
     // PSC Pooling END
     // see UWorldSubsystem (goto 21)
 	FObjectSubsystemCollection<UWorldSubsystem> SubsystemCollection;
 
+    /** 서브시스템들의 틱 단계(EWorldSubsystemTickPhase)를 실행하는 스케줄러 */
+	FWorldSubsystemTickScheduler SubsystemTickScheduler;
+
+    /** 
+     * UWorld::Tick의 각 단계 시점에서 호출되어, 해당 단계에서 틱하는 서브시스템들을 실행한다.
+     * 서브시스템 목록이 바뀌었으면 먼저 스케줄을 다시 만든다.
+     * 
+     * kwakkh
+     * - 스케줄은 이미 생성된 서브시스템으로만 만든다. (지연 모드에서 미뤄둔 서브시스템을 틱 스케줄 때문에 만들지 않음)
+     * - 워커 스레드에서 실행되는 서브시스템이 있으면, 그 단계 전에 미뤄둔 서브시스템을 게임 스레드에서 모두 만든다.
+     *   병렬 TickPhase 안의 GetSubsystem이 지연 생성(게임 스레드 전용)에 걸리지 않도록 하기 위함이다.
+     *   (지연 모드는 주로 틱하지 않는 프리뷰/비활성 월드용이므로, 병렬 틱을 하는 월드에서 잃는 것은 거의 없다)
+     */
+	void RunSubsystemTickPhase(EWorldSubsystemTickPhase Phase, float DeltaSeconds)
+    {
+        check(IsInGameThread());
+        RebuildSubsystemTickScheduleIfNeeded();
+
+        if (SubsystemCollection.HasDeferredSubsystems() && SubsystemTickScheduler.HasParallelWork(Phase))
+        {
+            SubsystemCollection.CreateAllDeferredSubsystems();
+            RebuildSubsystemTickScheduleIfNeeded();
+        }
+        SubsystemTickScheduler.RunPhase(Phase, DeltaSeconds);
+    }
+
+	void RebuildSubsystemTickScheduleIfNeeded()
+    {
+        if (SubsystemTickScheduler.BuiltForSerialNumber != SubsystemCollection.GetChangeSerialNumber())
+        {
+            TArray<UWorldSubsystem*> CreatedSubsystems;
+            SubsystemCollection.GetCreatedSubsystems(CreatedSubsystems);
+            SubsystemTickScheduler.Rebuild(CreatedSubsystems);
+            SubsystemTickScheduler.BuiltForSerialNumber = SubsystemCollection.GetChangeSerialNumber();
+        }
+    }
+
+    /** Spawn Actors with given transform and SpawnParameters */
+	ENGINE_API AActor* SpawnActor(UClass* Class, FTransform const* UserTransformPtr, const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters())
+    {
+        //...
+        LevelToSpawnIn->Actors.Add(Actor);
+        LevelToSpawnIn->ActorsForGC.Add(Actor);
+        LevelToSpawnIn->OnActorAdded(Actor);
+        //...
+    }
+
+    /** Removes the actor from its level's actor list and generally cleans up the engine's internal state. */
+	ENGINE_API void RemoveActor(AActor* Actor, bool bShouldModifyLevel) const
+    {
+        if (ULevel* CheckLevel = Actor->GetLevel())
+        {
+            const int32 ActorListIndex = CheckLevel->Actors.Find(Actor);
+            if (ActorListIndex != INDEX_NONE)
+            {
+                //...
+                CheckLevel->Actors[ActorListIndex] = nullptr;
+                CheckLevel->OnActorRemoved(ActorListIndex);
+            }
+            //...
+        }
+    }
+
+    /**
+     * Update the level after a variable amount of time, DeltaSeconds, has passed.
+     * All child actors are ticked after their owners have been ticked.
+     */
+	ENGINE_API void Tick(ELevelTick TickType, float DeltaSeconds)
+    {
+        //...
+        RunSubsystemTickPhase(EWorldSubsystemTickPhase::PrePhysics, DeltaSeconds);
+        RunTickGroup(TG_PrePhysics);
+        // kwakkh : PrePhysics에서 움직인 컴포넌트들의 트랜스폼을 물리 시뮬레이션 시작 전에 한 번에 반영한다
+        TransformHierarchy.Flush();
+        RunTickGroup(TG_StartPhysics);
+        RunTickGroup(TG_DuringPhysics, false); // No wait here, we should run until idle though. We don't care if all of the async ticks are done before we start running post-phys stuff
+        RunTickGroup(TG_EndPhysics); // wait for physics
+        RunTickGroup(TG_PostPhysics);
+        RunSubsystemTickPhase(EWorldSubsystemTickPhase::PostPhysics, DeltaSeconds);
+        //...
+        RunTickGroup(TG_PostUpdateWork);
+        RunSubsystemTickPhase(EWorldSubsystemTickPhase::PostUpdateWork, DeltaSeconds);
+        RunTickGroup(TG_LastDemotable);
+        //...
+    }
+
+    /** Send all render updates to the rendering thread. */
+	ENGINE_API void SendAllEndOfFrameUpdates()
+    {
+        // kwakkh : 렌더 트랜스폼을 보내기 전에 이번 프레임에 남은 계층 갱신을 반영한다 (MarkRenderTransformDirty가 여기서 모인다)
+        TransformHierarchy.Flush();
+        //...
+    }
+
     /** line batchers: */
     // kwakkh: debug lines
     // - ULineBatchComponents are resided in UWorld's subobjects
@@ -373,4 +1583,41 @@ class UWorld final : public UObject, public FNetworkNotify
      *                                                                                   └──Component3          
      * search 'goto 4'
      */
-};
\ No newline at end of file
+};
+
+inline bool FWorldPool::HasRoomFor(const UWorld* World) const
+{
+    check(IsInGameThread());
+    if (GWorldPoolMaxWorldsPerKey <= 0)
+    {
+        return false;
+    }
+    const TArray<UWorld*>* Worlds = PooledWorlds.Find(FKey(World->WorldType, World->PoolingValues));
+    return !Worlds || Worlds->Num() < GWorldPoolMaxWorldsPerKey;
+}
+
+inline bool FWorldPool::Release(UWorld* World)
+{
+    check(IsInGameThread());
+    TArray<UWorld*>& Worlds = PooledWorlds.FindOrAdd(FKey(World->WorldType, World->PoolingValues));
+    if (Worlds.Num() >= GWorldPoolMaxWorldsPerKey)
+    {
+        return false;
+    }
+    Worlds.Add(World);
+    return true;
+}
+
+inline void FWorldPool::Empty()
+{
+    check(IsInGameThread());
+    for (TPair<FKey, TArray<UWorld*>>& Pair : PooledWorlds)
+    {
+        for (UWorld* World : Pair.Value)
+        {
+            World->DestroyWorld(false);
+            World->RemoveFromRoot();
+        }
+    }
+    PooledWorlds.Empty();
+}